@@ -32,6 +32,11 @@
 #include <optional> // C++17, only needed on the new-API path
 #endif
 
+// The VARIANT type (duckdb v1.4+); read_yaml's nested_type := 'variant' needs it
+#if __has_include("duckdb/common/types/variant.hpp")
+#define DUCKDB_HAS_VARIANT_TYPE 1
+#endif
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
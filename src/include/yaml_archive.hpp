@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// yaml_archive.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/file_system.hpp"
+#include <functional>
+
+namespace duckdb {
+
+/**
+ * @brief Streaming reader for YAML members of tar archives
+ *
+ * Archive-aware paths name an archive followed by a member pattern, e.g.
+ * "chart.tgz/templates/*.yaml" or "bundle.tar/config/*.yml". Plain ".tar" archives and
+ * gzip-compressed ".tgz"/".tar.gz" archives are supported. The archive is read
+ * sequentially in one pass; members are never extracted to disk.
+ */
+class YAMLArchive {
+public:
+	//! Callback receiving the name and content of each matching member
+	using member_callback_t = std::function<void(const string &member_name, string &content)>;
+
+	/**
+	 * @brief Split an archive-aware path into the archive and the member pattern, by name only
+	 *
+	 * @param path Path as given to read_yaml
+	 * @param archive_path Receives the archive part (up to and including the archive extension)
+	 * @param member_pattern Receives the member pattern (empty if the path names the archive only)
+	 * @return bool Whether a path segment has an archive extension
+	 */
+	static bool SplitPath(const string &path, string &archive_path, string &member_pattern);
+
+	/**
+	 * @brief Split a resolved path into the archive and the member pattern if it names archive members
+	 *
+	 * Unlike SplitPath, a path is only archive-aware when its archive part is an existing file and
+	 * the path itself is not, so "backup.tar/config.yaml" in a directory named "backup.tar" is an
+	 * ordinary file. A path naming an archive file on its own refers to its members.
+	 *
+	 * @return bool Whether the path refers to an archive
+	 */
+	static bool ResolvePath(FileSystem &fs, const string &path, string &archive_path, string &member_pattern);
+
+	/**
+	 * @brief The path of the file holding the data: the archive for archive-aware paths
+	 */
+	static string StoragePath(FileSystem &fs, const string &path);
+
+	/**
+	 * @brief Whether a member name matches a pattern (see yaml_utils::MatchPathPattern).
+	 * An empty pattern matches every .yaml and .yml member.
+	 */
+	static bool MatchMember(const string &member_name, const string &member_pattern);
+
+	/**
+	 * @brief Stream through an archive once, passing each matching regular file member
+	 *
+	 * @param fs File system to use
+	 * @param archive_path Path of the archive
+	 * @param member_pattern Pattern selecting the members
+	 * @param maximum_member_size Members larger than this are rejected
+	 * @param skip_oversized Skip oversized members instead of throwing
+	 * @param callback Called for each matching member in archive order
+	 */
+	static void ReadMembers(FileSystem &fs, const string &archive_path, const string &member_pattern,
+	                        idx_t maximum_member_size, bool skip_oversized, const member_callback_t &callback);
+};
+
+} // namespace duckdb
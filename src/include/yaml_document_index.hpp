@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// yaml_document_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/file_system.hpp"
+
+namespace duckdb {
+
+/**
+ * @brief Byte range and header metadata of one document in a multi-document YAML file
+ */
+struct YAMLDocumentSpan {
+	idx_t byte_offset = 0;   // Offset of the first byte of the document (including its "---" header line)
+	idx_t byte_length = 0;   // Length in bytes, up to the next document header or the end of the file
+	string tag;              // Header tag, e.g. "!u!1" from "--- !u!1 &12345" (empty if none)
+	string anchor;           // Header anchor without the leading '&' (empty if none)
+	bool terminated = false; // Closed by a following "---" or a "..." marker (set by the scanner)
+	// Directive block ("%TAG ...", "%YAML ...") in effect for the document. yaml-cpp keeps the
+	// directives of the last document that declared any, so this can lie in an earlier span.
+	idx_t directives_offset = 0;
+	idx_t directives_length = 0; // 0 if no directives are in effect
+
+	//! Whether the directives in effect come from an earlier document, so parsing the span on
+	//! its own needs them prepended
+	bool InheritsDirectives() const {
+		return directives_length > 0 && directives_offset != byte_offset;
+	}
+};
+
+/**
+ * @brief Incremental document boundary scanner
+ *
+ * Finds document boundaries by looking only at line starts ("---" headers, "..." end
+ * markers, directives and comments), so a file can be indexed in fixed-size chunks
+ * without building any YAML nodes. Feed() may be called with arbitrary chunk sizes;
+ * lines split across chunks are carried over.
+ */
+class YAMLDocumentScanner {
+public:
+	void Feed(const char *data, idx_t size);
+	void Finish();
+
+	vector<YAMLDocumentSpan> spans;
+
+private:
+	void ProcessLine(const char *line, idx_t len, idx_t line_offset, idx_t next_offset);
+	void OpenDocument(idx_t start, idx_t header_offset, const char *header, idx_t header_len);
+	void CloseDocument(idx_t end, bool terminated);
+
+	string carry;              // Prefix of a line left over from the previous chunk
+	bool carry_active = false; // Whether a partial line is being carried
+	idx_t carry_offset = 0;    // Absolute offset of the carried partial line
+	idx_t consumed = 0;        // Total bytes fed so far
+	bool in_document = false;  // Whether a document is currently open
+	bool has_pending = false;  // Whether a directive/comment block precedes the next document
+	idx_t pending_start = 0;   // Start of that block (directives belong to the following document)
+	bool pending_directives = false; // Whether that block holds directives
+	idx_t directives_offset = 0;     // Directive block currently in effect
+	idx_t directives_length = 0;
+};
+
+/**
+ * @brief Document offset index for multi-document YAML files
+ *
+ * The index can be persisted next to the data file as "<path>.yidx" so that
+ * later reads can jump straight to selected documents. A sidecar is only used
+ * when its recorded size and modification time still match the data file.
+ */
+class YAMLDocumentIndex {
+public:
+	static constexpr const char *SIDECAR_SUFFIX = ".yidx";
+
+	/**
+	 * @brief Get the document spans of a file, from a valid sidecar or by scanning
+	 *
+	 * @param fs File system to use
+	 * @param handle Open handle to the data file
+	 * @param file_path Path of the data file (used to locate the sidecar)
+	 * @param write_sidecar Whether to (re)write the sidecar after a scan
+	 * @return vector<YAMLDocumentSpan> Spans in document order
+	 */
+	static vector<YAMLDocumentSpan> Load(FileSystem &fs, FileHandle &handle, const string &file_path,
+	                                     bool write_sidecar);
+
+	/**
+	 * @brief Scan a file for document boundaries without parsing it
+	 */
+	static vector<YAMLDocumentSpan> Scan(FileHandle &handle);
+
+	static string SidecarPath(const string &file_path);
+
+private:
+	static bool TryReadSidecar(FileSystem &fs, const string &sidecar_path, idx_t file_size, int64_t file_mtime,
+	                           vector<YAMLDocumentSpan> &spans);
+	static void WriteSidecar(FileSystem &fs, const string &sidecar_path, idx_t file_size, int64_t file_mtime,
+	                         const vector<YAMLDocumentSpan> &spans);
+};
+
+} // namespace duckdb
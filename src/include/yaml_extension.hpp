@@ -23,4 +23,7 @@ void RegisterYAMLCopyFunctions(ExtensionLoader &loader);
 // Register YAML frontmatter reader function
 void RegisterYAMLFrontmatterFunction(ExtensionLoader &loader);
 
+// Register yaml_document_index table function
+void RegisterYAMLDocumentIndexFunction(ExtensionLoader &loader);
+
 } // namespace duckdb
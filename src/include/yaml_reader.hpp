@@ -8,14 +8,18 @@
 
 #pragma once
 
+#include <deque>
 #include <vector>
 #include "duckdb.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/cast/cast_function_set.hpp"
 #include "duckdb/function/cast/default_casts.hpp"
+#include "duckdb/function/copy_function.hpp"
+#include "duckdb/function/scalar/strftime_format.hpp"
 #include "duckdb/function/replacement_scan.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
@@ -27,6 +31,7 @@
 namespace duckdb {
 
 class TableRef;
+class LogicalGet;
 struct ReplacementScanData;
 
 /**
@@ -39,6 +44,63 @@ enum class MultiDocumentMode {
 	LIST         // All documents as single row with STRUCT[] column
 };
 
+/**
+ * @brief How plain scalars are resolved to types (schema := ...)
+ */
+enum class YAMLResolutionSchema {
+	YAML11, // YAML 1.1 style: yes/no/on/off booleans, dates, timestamps, UUIDs (default)
+	CORE,   // YAML 1.2 core schema: only its null, bool, int and float forms; quoted scalars are strings
+	JSON    // YAML 1.2 JSON schema: JSON literals and numbers only
+};
+
+/**
+ * @brief Reuse of parse results for byte-identical content within a scan
+ */
+enum class YAMLDedupMode {
+	NONE,     // Every file is parsed
+	FILES,    // Byte-identical files are parsed once
+	DOCUMENTS // Byte-identical files and documents are parsed once
+};
+
+/**
+ * @brief Parsed content of one scan, keyed by content digest (dedupe := 'files' or 'documents')
+ *
+ * Repeated content reuses the nodes parsed for its first occurrence. Entries are keyed by the
+ * 128-bit MD5 digest and length of their content, so the content itself is not kept. Only the
+ * documents parsed from MAX_CACHED_BYTES of distinct content are kept; beyond that the oldest
+ * entries are evicted, and their content is parsed again if it repeats.
+ */
+class YAMLContentCache {
+public:
+	//! Size of the distinct content whose parsed documents are kept at a time
+	static constexpr idx_t MAX_CACHED_BYTES = 32 * 1024 * 1024;
+
+	explicit YAMLContentCache(bool reuse_documents) : reuse_documents(reuse_documents) {
+	}
+
+	//! Key of the whole content of a file or archive member
+	static string FileKey(const string &content);
+	//! Key of one document: the directives in effect for it (if any) followed by its text
+	static string DocumentKey(const char *directives, idx_t directives_size, const char *text, idx_t text_size);
+
+	bool Lookup(const string &key, vector<YAML::Node> &docs);
+	void Store(const string &key, idx_t content_size, vector<YAML::Node> docs);
+
+	//! Whether single documents of multi-document files are reused as well
+	const bool reuse_documents;
+
+private:
+	struct Entry {
+		vector<YAML::Node> docs;
+		idx_t content_size;
+	};
+
+	mutex lock;
+	unordered_map<string, Entry> entries;
+	std::deque<string> insertion_order; // Oldest entries are evicted first
+	idx_t cached_bytes = 0;
+};
+
 /**
  * @brief YAML Reader class for handling YAML files in DuckDB
  *
@@ -52,6 +114,29 @@ enum class MultiDocumentMode {
  */
 class YAMLReader {
 public:
+	// Column ids of the virtual columns of read_yaml (virtual column ids start at 2^63)
+	static constexpr column_t LAST_MODIFIED_COLUMN_ID = UINT64_C(9223372036854775808) + 16;
+	static constexpr column_t DOC_END_OFFSET_COLUMN_ID = UINT64_C(9223372036854775808) + 17;
+	static constexpr column_t CONTENT_HASH_COLUMN_ID = UINT64_C(9223372036854775808) + 18;
+
+	// Column holding the keys without a typed column when shred_threshold is set
+	static constexpr const char *REST_COLUMN_NAME = "_rest";
+	// Column naming the records path of each row when records lists several paths
+	static constexpr const char *RECORD_PATH_COLUMN_NAME = "record_path";
+
+	// Options that change how scalars are typed; used for both detection and conversion
+	struct YAMLScalarOptions {
+		// Which scalar forms are typed at all
+		YAMLResolutionSchema schema = YAMLResolutionSchema::YAML11;
+		// Type fixed-point literals such as 12.50 as DECIMAL(p,s) instead of DOUBLE
+		bool detect_decimal = false;
+		// dateformat / timestampformat, compiled once at bind time
+		bool has_date_format = false;
+		StrpTimeFormat date_format;
+		bool has_timestamp_format = false;
+		StrpTimeFormat timestamp_format;
+	};
+
 	// Structure to hold YAML read options
 	struct YAMLReadOptions {
 		bool auto_detect_types = true;         // Whether to auto-detect types from YAML content
@@ -69,7 +154,9 @@ public:
 		vector<LogicalType> column_types; // User-provided column types
 
 		// Records path for extracting records from nested structure (issue #22)
-		string records_path; // Dot-notation path to array of records (e.g., "data.items" or "projects")
+		// Dot-notation paths to arrays of records (e.g., "data.items" or "projects"). With several
+		// paths, every file is parsed once and a record_path column tells the streams apart
+		vector<string> records_paths;
 
 		// FRONTMATTER mode options
 		bool frontmatter_as_columns =
@@ -82,6 +169,38 @@ public:
 		// Strip non-standard suffixes from document headers (e.g., "--- !tag &anchor suffix" -> "--- !tag &anchor")
 		// This enables parsing of files with custom document annotations like Unity's "stripped" keyword
 		bool strip_document_suffixes = true;
+
+		// Document selection by position (0-based, per file, sorted and de-duplicated)
+		// When set, only these documents are read, using the document offset index
+		vector<idx_t> document_indexes;
+
+		// Incremental ingestion: skip files whose modification time is before this watermark
+		bool has_modified_since = false;
+		timestamp_t modified_since;
+
+		// Tail mode for append-only multi-document files: read complete documents starting at this byte offset
+		bool has_start_offset = false;
+		idx_t start_offset = 0;
+
+		// JSON Schema / OpenAPI / CRD file that defines the columns; replaces sampling entirely
+		string schema_file;
+
+		// nested_type := 'variant': map and sequence values become VARIANT columns, each typed by
+		// its own content instead of a STRUCT covering every sampled row
+		bool nested_variant = false;
+
+		// Shredding: top-level keys present in at least this fraction of sampled rows become typed
+		// columns, all other keys go to a single YAML "_rest" column (0 disables)
+		double shred_threshold = 0;
+
+		// Parse byte-identical files (and documents) once per scan and reuse the parsed nodes
+		YAMLDedupMode dedupe = YAMLDedupMode::NONE;
+
+		// detect_decimal, dateformat and timestampformat
+		YAMLScalarOptions scalar;
+
+		// Columns holding untagged base64 text: typed BLOB and decoded during the scan
+		vector<string> base64_columns;
 	};
 
 	/**
@@ -93,6 +212,27 @@ public:
 	 */
 	static void RegisterFunction(ExtensionLoader &loader);
 
+	/**
+	 * @brief Get the read_yaml table function (also used as the COPY ... FROM scan)
+	 */
+	static TableFunction GetReadYAMLFunction();
+
+	/**
+	 * @brief Bind function for COPY ... FROM (FORMAT yaml)
+	 *
+	 * Uses the target table's columns as the schema: no sampling or type detection,
+	 * values are converted straight to the target types.
+	 *
+	 * @param context Client context
+	 * @param input COPY statement info
+	 * @param expected_names Target column names
+	 * @param expected_types Target column types
+	 * @return Function data for the read_yaml scan
+	 */
+	static unique_ptr<FunctionData> YAMLCopyFromBind(ClientContext &context, CopyFromFunctionBindInput &input,
+	                                                 vector<string> &expected_names,
+	                                                 vector<LogicalType> &expected_types);
+
 	/**
 	 * @brief Replace a yaml file string with 'read_yaml'
 	 *
@@ -134,6 +274,32 @@ private:
 	 */
 	static void YAMLReadRowsFunction(ClientContext &context, TableFunctionInput &input, DataChunk &output);
 
+	/**
+	 * @brief Init function for read_yaml global state
+	 *
+	 * @param context Client context
+	 * @param input Init input data (projected column ids)
+	 * @return Global state for execution
+	 */
+	static unique_ptr<GlobalTableFunctionState> YAMLReadRowsInit(ClientContext &context, TableFunctionInitInput &input);
+
+	/**
+	 * @brief Virtual columns of read_yaml (last_modified, doc_end_offset)
+	 */
+	static virtual_column_map_t YAMLReadRowsVirtualColumns(ClientContext &context,
+	                                                       optional_ptr<FunctionData> bind_data);
+
+	/**
+	 * @brief Prune files using filters on the last_modified virtual column
+	 *
+	 * @param context Client context
+	 * @param get The scan operator
+	 * @param bind_data Bind data of the scan (file list is pruned in place)
+	 * @param filters Filters on the scan (left in place)
+	 */
+	static void YAMLReadRowsPushdownFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data,
+	                                       vector<unique_ptr<Expression>> &filters);
+
 	/**
 	 * @brief Bind function for read_yaml_objects that returns each document as a column
 	 *
@@ -176,6 +342,13 @@ public:
 	 */
 	static vector<string> GetFiles(ClientContext &context, const Value &path_value, bool ignore_errors);
 
+	/**
+	 * @brief Drop all cached read_yaml schemas
+	 *
+	 * @return idx_t Number of entries dropped
+	 */
+	static idx_t ClearSchemaCache();
+
 private:
 	/**
 	 * @brief Get files from a glob pattern
@@ -186,6 +359,15 @@ private:
 	 */
 	static vector<string> GetGlobFiles(ClientContext &context, const string &pattern);
 
+	/**
+	 * @brief Get the .yaml and .yml files of a directory from a single listing
+	 *
+	 * @param context Client context for file operations
+	 * @param directory Directory to list
+	 * @return vector<string> Sorted file paths
+	 */
+	static vector<string> GetDirectoryYAMLFiles(ClientContext &context, const string &directory);
+
 	/**
 	 * @brief Get files from a file list
 	 *
@@ -210,27 +392,54 @@ public:
 	/**
 	 * @brief Detect the type of a YAML node
 	 *
+	 * Besides the basic scalar types, canonical (lowercase) UUIDs are detected as UUID and
+	 * integers beyond the BIGINT range as UBIGINT or HUGEINT.
+	 *
 	 * @param node YAML node to inspect
+	 * @param scalar_options detect_decimal and custom date/timestamp formats (optional)
 	 * @return LogicalType The detected DuckDB type
 	 */
-	static LogicalType DetectYAMLType(const YAML::Node &node);
+	static LogicalType DetectYAMLType(const YAML::Node &node, const YAMLScalarOptions *scalar_options = nullptr);
+
+	/**
+	 * @brief The VARIANT type used for nested values with nested_type := 'variant'
+	 *
+	 * Throws a BinderException on DuckDB versions without the VARIANT type.
+	 */
+	static LogicalType GetVariantType();
 
 	/**
 	 * @brief Detect YAML type across multiple documents with jagged schema support
 	 *
 	 * @param nodes Vector of YAML nodes to inspect for merged schema
+	 * @param scalar_options detect_decimal and custom date/timestamp formats (optional)
 	 * @return LogicalType The detected DuckDB type with merged fields
 	 */
-	static LogicalType DetectJaggedYAMLType(const vector<YAML::Node> &nodes);
+	static LogicalType DetectJaggedYAMLType(const vector<YAML::Node> &nodes,
+	                                        const YAMLScalarOptions *scalar_options = nullptr);
 
 	/**
 	 * @brief Convert a YAML node to a DuckDB value
 	 *
 	 * @param node YAML node to convert
 	 * @param target_type Target type to convert to
+	 * @param scalar_options Custom date/timestamp formats to try first (optional)
 	 * @return Value The converted value
 	 */
-	static Value YAMLNodeToValue(const YAML::Node &node, const LogicalType &target_type);
+	static Value YAMLNodeToValue(const YAML::Node &node, const LogicalType &target_type,
+	                             const YAMLScalarOptions *scalar_options = nullptr);
+
+	/**
+	 * @brief Whether a node carries the standard !!binary tag (base64 content)
+	 */
+	static bool IsBinaryNode(const YAML::Node &node);
+
+	/**
+	 * @brief Decode base64 text (e.g. a !!binary scalar) straight into a row of a BLOB vector
+	 *
+	 * Line breaks and spaces of block scalars are skipped; invalid base64 gives NULL.
+	 */
+	static void WriteBase64Blob(const string &base64, Vector &result, idx_t row);
 
 	/**
 	 * @brief Read a YAML file and parse it into documents
@@ -238,10 +447,15 @@ public:
 	 * @param context Client context for file operations
 	 * @param file_path Path to the YAML file
 	 * @param options YAML read options
+	 * @param doc_end_offsets Optional output: byte offset just past each returned document, filled
+	 *                        when documents are read by position (doc_index or start_offset)
+	 * @param content_cache Optional parse results to reuse for byte-identical content
+	 * @param content_hash Optional output: hash of the file content, set when the whole file is read
 	 * @return vector<YAML::Node> Parsed YAML documents
 	 */
 	static vector<YAML::Node> ReadYAMLFile(ClientContext &context, const string &file_path,
-	                                       const YAMLReadOptions &options);
+	                                       const YAMLReadOptions &options, vector<idx_t> *doc_end_offsets = nullptr,
+	                                       YAMLContentCache *content_cache = nullptr, Value *content_hash = nullptr);
 
 	/**
 	 * @brief Parse a multi-document YAML file with error recovery
@@ -252,6 +466,20 @@ public:
 	 */
 	static vector<YAML::Node> ParseMultiDocumentYAML(const string &yaml_content, bool ignore_errors);
 
+	/**
+	 * @brief Parse all documents of a YAML string, one document at a time
+	 *
+	 * Returns the same documents as YAML::LoadAll; an interrupted query stops between
+	 * documents instead of after the whole input was parsed. With a content cache the
+	 * content is split on document boundaries first, so repeated documents are looked up
+	 * before they are parsed.
+	 *
+	 * @param yaml_content The YAML content to parse
+	 * @param content_cache Optional parsed documents to reuse for byte-identical documents
+	 * @return vector<YAML::Node> Parsed documents (throws YAML::Exception on a parse error)
+	 */
+	static vector<YAML::Node> LoadDocuments(const string &yaml_content, YAMLContentCache *content_cache = nullptr);
+
 	/**
 	 * @brief Extract row nodes from YAML documents
 	 *
@@ -321,11 +549,19 @@ public:
 	 *
 	 * Numeric types promote along DOUBLE > HUGEINT > BIGINT > INTEGER > SMALLINT so that e.g.
 	 * TINYINT + SMALLINT -> SMALLINT and INT + DOUBLE -> DOUBLE, matching the within-node
-	 * sequence widening. Genuinely incompatible pairs (number vs string) return the YAML type.
+	 * sequence widening. UBIGINT with any other integer type becomes HUGEINT, and DECIMALs
+	 * widen to a DECIMAL holding both (DOUBLE beyond 38 digits).
+	 * Genuinely incompatible pairs (number vs string) return the YAML type.
 	 * Callers that want a VARCHAR fallback instead should guard on IsNumeric() before calling.
 	 */
 	static LogicalType WidenConflictingScalarTypes(const LogicalType &type1, const LogicalType &type2);
 
+	/**
+	 * @brief Whether two detected types need WidenConflictingScalarTypes: their ids differ, or
+	 * they are DECIMALs of different width or scale.
+	 */
+	static bool TypesNeedWidening(const LogicalType &type1, const LogicalType &type2);
+
 	/**
 	 * @brief Bind the columns parameter for explicit type specification
 	 *
@@ -335,6 +571,20 @@ public:
 	 */
 	static void BindColumnTypes(ClientContext &context, TableFunctionBindInput &input, YAMLReadOptions &options);
 
+	/**
+	 * @brief Derive columns from a JSON Schema, OpenAPI schema or Kubernetes CRD file
+	 *
+	 * Maps the record schema's properties to columns: objects to STRUCT, additionalProperties
+	 * to MAP, enums to ENUM, arrays to LIST and untyped or free-form values to YAML.
+	 *
+	 * @param context Client context for file operations
+	 * @param schema_file Path to the schema file (JSON or YAML)
+	 * @param names Output column names, in schema order
+	 * @param types Output column types
+	 */
+	static void BindSchemaFile(ClientContext &context, const string &schema_file, vector<string> &names,
+	                           vector<LogicalType> &types);
+
 	/**
 	 * @brief Navigate to a nested path within a YAML node using dot notation
 	 *
@@ -24,6 +24,9 @@ private:
 	// Register resource-limit configuration functions (DoS hardening)
 	static void RegisterLimitFunctions(ExtensionLoader &loader);
 
+	// Register read_yaml schema cache functions
+	static void RegisterSchemaCacheFunctions(ExtensionLoader &loader);
+
 	// Register from_yaml function for converting YAML to structured types
 	static void RegisterFromYAMLFunction(ExtensionLoader &loader);
 };
@@ -45,10 +45,21 @@ YAMLStringStyle ResolveStringStyle(YAMLStringStyle style, YAMLFormat format);
 //   do not pass through the parser.
 // - MAX_INPUT_SIZE bounds string input to the scalar functions and the
 //   frontmatter reader, which previously had no size cap (only the file
-//   readers did).
+//   readers did). It also bounds a single scalar while parsing.
+// - MAX_ALIAS_REFERENCES bounds the number of alias ("*a") references in one
+//   document while parsing.
+//
+// LoadYAML/LoadAllYAML enforce all of these while the parser emits events, so
+// a hostile input is rejected after at most the work the limits allow rather
+// than after a full parse.
 constexpr idx_t YAML_DEFAULT_MAX_EXPANSION_NODES = 50000000; // 50M node visits
 constexpr idx_t YAML_DEFAULT_MAX_NESTING_DEPTH = 1000;       // recursion depth
 constexpr idx_t YAML_DEFAULT_MAX_INPUT_SIZE = 16777216;      // 16 MB
+constexpr idx_t YAML_DEFAULT_MAX_ALIAS_REFERENCES = 1000000; // alias references per document
+
+// Number of node visits between two checks of the client's interrupt flag
+// (a power of two, so the check is a mask test on the budget's node count).
+constexpr idx_t YAML_INTERRUPT_CHECK_INTERVAL = 4096;
 
 // Global YAML settings management
 class YAMLSettings {
@@ -64,12 +75,20 @@ public:
 	static idx_t GetMaxNestingDepth();
 	static void SetMaxInputSize(idx_t value);
 	static idx_t GetMaxInputSize();
+	static void SetMaxAliasReferences(idx_t value);
+	static idx_t GetMaxAliasReferences();
+
+	// Reuse of detected read_yaml schemas while the sampled files are unchanged
+	static void SetSchemaCacheEnabled(bool value);
+	static bool GetSchemaCacheEnabled();
 
 private:
 	static YAMLFormat default_format;
 	static idx_t max_expansion_nodes;
 	static idx_t max_nesting_depth;
 	static idx_t max_input_size;
+	static idx_t max_alias_references;
+	static bool schema_cache_enabled;
 };
 
 //===--------------------------------------------------------------------===//
@@ -106,11 +125,60 @@ private:
 	YAMLTraversalBudget &budget;
 };
 
+//===--------------------------------------------------------------------===//
+// Interrupt checkpoints
+//===--------------------------------------------------------------------===//
+// Parsing and converting a single large or alias-heavy input can take long
+// enough that a query must be cancellable in the middle of it. Entry points
+// that have a ClientContext (table function bind/scan, scalar functions) open
+// a YAMLInterruptScope; while it is active, every YAMLBudgetScope polls the
+// client's interrupt flag each YAML_INTERRUPT_CHECK_INTERVAL node visits and
+// the readers poll it between documents, throwing an InterruptException.
+// Conversions that map failures to NULL can swallow it, so scans and scalar
+// functions poll again per row or per chunk. The scope is thread-local and
+// nests, so helpers need no extra parameter.
+struct YAMLInterruptScope {
+	explicit YAMLInterruptScope(ClientContext &context);
+	~YAMLInterruptScope();
+	YAMLInterruptScope(const YAMLInterruptScope &) = delete;
+	YAMLInterruptScope &operator=(const YAMLInterruptScope &) = delete;
+
+private:
+	ClientContext *previous;
+};
+
+// Throw an InterruptException if the query of the active YAMLInterruptScope
+// was interrupted (no-op outside of a scope).
+void CheckInterrupted();
+
+// Scalars parsed by LoadYAML/LoadAllYAML are capped at yaml_set_max_input_size,
+// which bounds the input of the scalar functions. The file readers bound their
+// input with maximum_object_size instead and open a YAMLScalarSizeScope with it,
+// so a file they accept is not rejected for one large scalar. Thread-local and
+// nesting like YAMLInterruptScope.
+struct YAMLScalarSizeScope {
+	explicit YAMLScalarSizeScope(idx_t max_scalar_size);
+	~YAMLScalarSizeScope();
+	YAMLScalarSizeScope(const YAMLScalarSizeScope &) = delete;
+	YAMLScalarSizeScope &operator=(const YAMLScalarSizeScope &) = delete;
+
+private:
+	idx_t previous;
+};
+
 // Validate that a string input does not exceed the configured maximum size.
 // Throws InvalidInputException when the limit is exceeded. `context` is used
 // only for the error message (which function rejected the input).
 void CheckInputSize(idx_t size, const char *context);
 
+// Match a path against a glob pattern: "*" and "?" stay within a directory, "**" spans
+// directories (and "**/" may match none) and "{a,b}" lists alternatives.
+bool MatchPathPattern(const string &path, const string &pattern);
+
+// Append a mapping key to a "$.key[0]" style path (as accepted by yaml_extract). Keys
+// containing '.', '[', ']', quotes or backslashes are double-quoted with backslash escapes.
+void AppendYAMLPathKey(string &path, const string &key);
+
 // Walk a parsed node, counting every visit (re-materializing shared alias
 // nodes without de-duplication) and throwing if the configured expansion or
 // depth budget is exceeded. Use at the entry of functions that traverse the
@@ -138,6 +206,38 @@ std::string EmitYAMLMultiDoc(const std::vector<YAML::Node> &docs, YAMLFormat for
 // Parse YAML string (supports multi-document)
 std::vector<YAML::Node> ParseYAML(const std::string &yaml_str, bool multi_document = true);
 
+// Drop-in replacements for YAML::Load / YAML::LoadAll that build the nodes with
+// a counting event handler: the expanded node count (aliases counted with the
+// size of their target), alias references, scalar size and nesting depth are
+// checked while parsing, throwing an InvalidInputException as soon as a limit
+// is exceeded. Syntax errors still throw YAML::Exception.
+YAML::Node LoadYAML(const std::string &input);
+YAML::Node LoadYAML(const char *data, idx_t size);
+std::vector<YAML::Node> LoadAllYAML(const std::string &input);
+
+// Where the nodes of a document start in its input. The tree mirrors the node tree:
+// `children` holds the entries of a sequence, or the values of a mapping, in iteration
+// order. Aliases get the mark of the alias and no children.
+struct YAMLSourceMarks {
+	YAML::Mark mark = YAML::Mark::null_mark();
+	std::vector<YAMLSourceMarks> children;
+};
+
+// LoadYAML that also records the start marks of the document's nodes
+YAML::Node LoadYAML(const std::string &input, YAMLSourceMarks &marks);
+
+// Recover the source text of a sequence or mapping node parsed from `input` and starting
+// at `mark`, so it can be returned as a copy instead of being re-emitted. Block nodes are
+// dedented to column 0. Returns false when the text cannot be taken over verbatim
+// (anchors, aliases and tags in the span, a byte order mark, or marks that do not line
+// up), in which case callers emit the node instead.
+bool TryGetYAMLSourceSpan(const std::string &input, const YAML::Node &node, const YAML::Mark &mark,
+                          std::string &result);
+
+// Text of a node parsed from `input`: its source span when recoverable, flow-style
+// emission otherwise (always when `marks` is nullptr)
+std::string YAMLNodeSourceText(const std::string &input, const YAML::Node &node, const YAMLSourceMarks *marks);
+
 //===--------------------------------------------------------------------===//
 // YAML to JSON Conversion
 //===--------------------------------------------------------------------===//
@@ -155,9 +255,11 @@ YAML::Node ValueToYAMLNode(const Value &value);
 // Emit DuckDB Value to YAML::Emitter
 void EmitValueToYAML(YAML::Emitter &out, const Value &value);
 
-// Convert DuckDB Value to YAML string
+// Convert DuckDB Value to YAML string. With deduplicate, repeated non-empty lists and
+// structs are written once with an "&anchor" and referenced as "*alias" afterwards.
 std::string ValueToYAMLString(const Value &value, YAMLFormat format,
-                              YAMLStringStyle string_style = YAMLStringStyle::AUTO, idx_t indent = 2);
+                              YAMLStringStyle string_style = YAMLStringStyle::AUTO, idx_t indent = 2,
+                              bool deduplicate = false);
 
 // Format with style and layout logic (simplified - no layout handling)
 std::string FormatPerStyleAndLayout(const Value &value, YAMLFormat format, const std::string &layout);
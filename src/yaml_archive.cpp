@@ -0,0 +1,278 @@
+#include "yaml_archive.hpp"
+#include "yaml_utils.hpp"
+#include "duckdb/common/string_util.hpp"
+#include <cstring>
+
+namespace duckdb {
+
+// Tar archives are sequences of 512-byte blocks: a header block per member followed by
+// the member data, padded to a whole block
+static constexpr idx_t TAR_BLOCK_SIZE = 512;
+// Chunk size used when skipping the data of members that are not read
+static constexpr idx_t SKIP_BUFFER_SIZE = 1 << 16;
+
+//===--------------------------------------------------------------------===//
+// Paths and member patterns
+//===--------------------------------------------------------------------===//
+
+static bool IsCompressedArchive(const string &path) {
+	auto lower = StringUtil::Lower(path);
+	return StringUtil::EndsWith(lower, ".tgz") || StringUtil::EndsWith(lower, ".tar.gz");
+}
+
+static bool IsArchive(const string &path) {
+	return IsCompressedArchive(path) || StringUtil::EndsWith(StringUtil::Lower(path), ".tar");
+}
+
+bool YAMLArchive::SplitPath(const string &path, string &archive_path, string &member_pattern) {
+	// The first path segment with an archive extension names the archive
+	idx_t segment_end = 0;
+	while (segment_end <= path.size()) {
+		auto slash = path.find('/', segment_end);
+		segment_end = slash == string::npos ? path.size() : slash;
+		if (segment_end > 0 && IsArchive(path.substr(0, segment_end))) {
+			archive_path = path.substr(0, segment_end);
+			member_pattern = segment_end < path.size() ? path.substr(segment_end + 1) : string();
+			return true;
+		}
+		segment_end++;
+	}
+	return false;
+}
+
+bool YAMLArchive::ResolvePath(FileSystem &fs, const string &path, string &archive_path, string &member_pattern) {
+	// Only paths with an archive extension in them cost file system calls
+	if (!SplitPath(path, archive_path, member_pattern)) {
+		return false;
+	}
+	if (fs.FileExists(path)) {
+		// An archive on its own refers to its members; any other file is read as is
+		if (!IsArchive(path)) {
+			return false;
+		}
+		archive_path = path;
+		member_pattern.clear();
+		return true;
+	}
+	// The first archive segment that is a file names the archive; the others are directories
+	idx_t segment_end = archive_path.size();
+	while (segment_end < path.size()) {
+		if (IsArchive(path.substr(0, segment_end)) && fs.FileExists(path.substr(0, segment_end))) {
+			archive_path = path.substr(0, segment_end);
+			member_pattern = path.substr(segment_end + 1);
+			return true;
+		}
+		auto slash = path.find('/', segment_end + 1);
+		segment_end = slash == string::npos ? path.size() : slash;
+	}
+	return false;
+}
+
+string YAMLArchive::StoragePath(FileSystem &fs, const string &path) {
+	string archive_path, member_pattern;
+	if (ResolvePath(fs, path, archive_path, member_pattern)) {
+		return archive_path;
+	}
+	return path;
+}
+
+bool YAMLArchive::MatchMember(const string &member_name, const string &member_pattern) {
+	if (member_pattern.empty()) {
+		auto lower = StringUtil::Lower(member_name);
+		return StringUtil::EndsWith(lower, ".yaml") || StringUtil::EndsWith(lower, ".yml");
+	}
+	return yaml_utils::MatchPathPattern(member_name, member_pattern);
+}
+
+//===--------------------------------------------------------------------===//
+// Tar stream
+//===--------------------------------------------------------------------===//
+
+// Sequential reader over the (decompressed) archive bytes
+class YAMLTarStream {
+public:
+	YAMLTarStream(FileHandle &handle, bool seekable) : handle(handle), seekable(seekable) {
+	}
+
+	// Read exactly size bytes; returns false at the end of the archive
+	bool Read(char *buffer, idx_t size) {
+		idx_t total = 0;
+		while (total < size) {
+			auto bytes_read = handle.Read(buffer + total, size - total);
+			if (bytes_read <= 0) {
+				if (total == 0) {
+					return false;
+				}
+				throw IOException("Unexpected end of tar archive");
+			}
+			total += NumericCast<idx_t>(bytes_read);
+		}
+		return true;
+	}
+
+	void Skip(idx_t size) {
+		if (size == 0) {
+			return;
+		}
+		if (seekable) {
+			handle.Seek(handle.SeekPosition() + size);
+			return;
+		}
+		// Compressed archives can only be read forward
+		skip_buffer.resize(SKIP_BUFFER_SIZE);
+		while (size > 0) {
+			auto chunk = MinValue<idx_t>(size, SKIP_BUFFER_SIZE);
+			if (!Read(&skip_buffer[0], chunk)) {
+				throw IOException("Unexpected end of tar archive");
+			}
+			size -= chunk;
+		}
+	}
+
+private:
+	FileHandle &handle;
+	bool seekable;
+	string skip_buffer;
+};
+
+static idx_t PaddedSize(idx_t size) {
+	return (size + TAR_BLOCK_SIZE - 1) / TAR_BLOCK_SIZE * TAR_BLOCK_SIZE;
+}
+
+// Numeric header field: octal digits, or big-endian base-256 when the high bit is set
+static idx_t ParseTarNumber(const char *field, idx_t len) {
+	idx_t result = 0;
+	if (static_cast<unsigned char>(field[0]) & 0x80) {
+		for (idx_t i = 1; i < len; i++) {
+			result = (result << 8) | static_cast<unsigned char>(field[i]);
+		}
+		return result;
+	}
+	for (idx_t i = 0; i < len && field[i]; i++) {
+		if (field[i] == ' ') {
+			continue;
+		}
+		if (field[i] < '0' || field[i] > '7') {
+			break;
+		}
+		result = (result << 3) | idx_t(field[i] - '0');
+	}
+	return result;
+}
+
+static string ParseTarString(const char *field, idx_t len) {
+	return string(field, strnlen(field, len));
+}
+
+static bool IsZeroBlock(const char *block) {
+	for (idx_t i = 0; i < TAR_BLOCK_SIZE; i++) {
+		if (block[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// The header checksum is the sum of all header bytes with the checksum field read as spaces
+static bool HasValidChecksum(const char *block) {
+	idx_t sum = 0;
+	for (idx_t i = 0; i < TAR_BLOCK_SIZE; i++) {
+		sum += (i >= 148 && i < 156) ? ' ' : static_cast<unsigned char>(block[i]);
+	}
+	return sum == ParseTarNumber(block + 148, 8);
+}
+
+// The "path" record of a pax extended header ("<length> path=<value>\n" records)
+static string ParsePaxPath(const string &records) {
+	idx_t pos = 0;
+	while (pos < records.size()) {
+		auto space = records.find(' ', pos);
+		if (space == string::npos) {
+			break;
+		}
+		auto length = std::strtoull(records.c_str() + pos, nullptr, 10);
+		if (length == 0 || pos + length > records.size()) {
+			break;
+		}
+		auto record = records.substr(space + 1, pos + length - space - 2);
+		if (StringUtil::StartsWith(record, "path=")) {
+			return record.substr(5);
+		}
+		pos += length;
+	}
+	return string();
+}
+
+void YAMLArchive::ReadMembers(FileSystem &fs, const string &archive_path, const string &member_pattern,
+                              idx_t maximum_member_size, bool skip_oversized, const member_callback_t &callback) {
+	bool compressed = IsCompressedArchive(archive_path);
+	auto handle = compressed ? fs.OpenFile(archive_path, FileFlags::FILE_FLAGS_READ | FileCompressionType::GZIP)
+	                         : fs.OpenFile(archive_path, FileFlags::FILE_FLAGS_READ);
+	YAMLTarStream stream(*handle, !compressed && handle->CanSeek());
+
+	char header[TAR_BLOCK_SIZE];
+	string long_name; // Name from a preceding GNU long name or pax header
+	while (stream.Read(header, TAR_BLOCK_SIZE)) {
+		if (IsZeroBlock(header)) {
+			break; // End-of-archive marker
+		}
+		if (!HasValidChecksum(header)) {
+			throw IOException("Invalid tar header in archive " + archive_path);
+		}
+		yaml_utils::CheckInterrupted();
+
+		auto size = ParseTarNumber(header + 124, 12);
+		auto type = header[156];
+		if (type == 'L' || type == 'x') {
+			// GNU long name / pax extended header: applies to the next member
+			if (size > maximum_member_size) {
+				throw IOException("Oversized tar header in archive " + archive_path);
+			}
+			string data(size, '\0');
+			if (!stream.Read(&data[0], size)) {
+				throw IOException("Unexpected end of tar archive " + archive_path);
+			}
+			stream.Skip(PaddedSize(size) - size);
+			long_name = type == 'L' ? ParseTarString(data.c_str(), size) : ParsePaxPath(data);
+			continue;
+		}
+
+		string name = long_name;
+		long_name.clear();
+		if (name.empty()) {
+			name = ParseTarString(header, 100);
+			auto prefix = ParseTarString(header + 345, 155);
+			if (memcmp(header + 257, "ustar", 5) == 0 && !prefix.empty()) {
+				name = prefix + "/" + name;
+			}
+		}
+		while (StringUtil::StartsWith(name, "./")) {
+			name = name.substr(2);
+		}
+
+		// Only regular files are read; directories, links and other entries are skipped
+		bool regular = type == '0' || type == '\0' || type == '7';
+		if (!regular || !MatchMember(name, member_pattern)) {
+			stream.Skip(PaddedSize(size));
+			continue;
+		}
+		if (size > maximum_member_size) {
+			if (!skip_oversized) {
+				throw IOException("Archive member " + archive_path + "/" + name + " (" + to_string(size) +
+				                  " bytes) exceeds maximum allowed size (" + to_string(maximum_member_size) +
+				                  " bytes)");
+			}
+			stream.Skip(PaddedSize(size));
+			continue;
+		}
+
+		string content(size, '\0');
+		if (size > 0 && !stream.Read(&content[0], size)) {
+			throw IOException("Unexpected end of tar archive " + archive_path);
+		}
+		stream.Skip(PaddedSize(size) - size);
+		callback(name, content);
+	}
+}
+
+} // namespace duckdb
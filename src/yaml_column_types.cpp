@@ -1,8 +1,10 @@
 #include "yaml_reader.hpp"
+#include "yaml_types.hpp"
 #include "duckdb_compat.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/types/vector.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
 
@@ -68,4 +70,239 @@ void YAMLReader::BindColumnTypes(ClientContext &context, TableFunctionBindInput
 	// where some columns are explicitly typed and others are auto-detected
 }
 
+//===--------------------------------------------------------------------===//
+// Schema hints from JSON Schema / OpenAPI files (schema_file parameter)
+//===--------------------------------------------------------------------===//
+
+// Nesting limit for schemas, including chains of $ref (recursive schemas end in a YAML column)
+static constexpr idx_t MAX_SCHEMA_DEPTH = 64;
+
+static YAML::Node GetSchemaKey(const YAML::Node &node, const string &key) {
+	if (!node.IsMap()) {
+		return YAML::Node(YAML::NodeType::Undefined);
+	}
+	auto value = node[key];
+	// Missing keys of a const node are invalid nodes, which throw on any further access
+	return value.IsDefined() ? value : YAML::Node(YAML::NodeType::Undefined);
+}
+
+static string GetSchemaString(const YAML::Node &node, const string &key) {
+	auto value = GetSchemaKey(node, key);
+	return value.IsDefined() && value.IsScalar() ? value.Scalar() : string();
+}
+
+static bool GetSchemaFlag(const YAML::Node &node, const string &key) {
+	auto value = GetSchemaKey(node, key);
+	return value.IsDefined() && value.IsScalar() && StringUtil::Lower(value.Scalar()) == "true";
+}
+
+// Resolve a local "$ref" JSON pointer (e.g. "#/definitions/spec", "#/$defs/spec");
+// returns an undefined node for remote or dangling references
+static YAML::Node ResolveSchemaRef(const YAML::Node &root, const string &ref) {
+	if (ref.empty() || ref[0] != '#') {
+		return YAML::Node(YAML::NodeType::Undefined);
+	}
+	YAML::Node current;
+	current.reset(root);
+	for (auto &segment : StringUtil::Split(ref.substr(1), '/')) {
+		if (segment.empty()) {
+			continue;
+		}
+		auto key = StringUtil::Replace(StringUtil::Replace(segment, "~1", "/"), "~0", "~");
+		YAML::Node next;
+		if (current.IsSequence()) {
+			idx_t pos;
+			try {
+				pos = std::stoull(key);
+			} catch (...) {
+				return YAML::Node(YAML::NodeType::Undefined);
+			}
+			if (pos >= current.size()) {
+				return YAML::Node(YAML::NodeType::Undefined);
+			}
+			next.reset(current[pos]);
+		} else {
+			next.reset(GetSchemaKey(current, key));
+		}
+		if (!next.IsDefined()) {
+			return next;
+		}
+		current.reset(next);
+	}
+	return current;
+}
+
+// The schema type name: "type" may be a list such as ["string", "null"]
+static string GetSchemaTypeName(const YAML::Node &schema) {
+	auto type = GetSchemaKey(schema, "type");
+	if (!type.IsDefined()) {
+		return string();
+	}
+	if (type.IsScalar()) {
+		return type.Scalar();
+	}
+	string result;
+	if (type.IsSequence()) {
+		for (auto it = type.begin(); it != type.end(); ++it) {
+			if (!it->IsScalar() || it->Scalar() == "null") {
+				continue;
+			}
+			if (!result.empty()) {
+				return string(); // Several non-null types: no single column type
+			}
+			result = it->Scalar();
+		}
+	}
+	return result;
+}
+
+static LogicalType SchemaEnumType(const YAML::Node &values) {
+	vector<string> names;
+	unordered_set<string> seen;
+	for (auto it = values.begin(); it != values.end(); ++it) {
+		if (it->IsNull()) {
+			continue;
+		}
+		if (!it->IsScalar()) {
+			return LogicalType::VARCHAR;
+		}
+		if (seen.insert(it->Scalar()).second) {
+			names.push_back(it->Scalar());
+		}
+	}
+	if (names.empty()) {
+		return LogicalType::VARCHAR;
+	}
+	Vector enum_values(LogicalType::VARCHAR, names.size());
+	auto enum_data = FlatVector::GetData<string_t>(enum_values);
+	for (idx_t idx = 0; idx < names.size(); idx++) {
+		enum_data[idx] = StringVector::AddString(enum_values, names[idx]);
+	}
+	return LogicalType::ENUM(enum_values, names.size());
+}
+
+static LogicalType SchemaToLogicalType(const YAML::Node &schema, const YAML::Node &root, idx_t depth) {
+	if (depth > MAX_SCHEMA_DEPTH || !schema.IsMap()) {
+		return YAMLTypes::YAMLType(); // "true" schemas, recursion: keep the raw YAML
+	}
+	auto ref = GetSchemaString(schema, "$ref");
+	if (!ref.empty()) {
+		auto target = ResolveSchemaRef(root, ref);
+		return target.IsDefined() ? SchemaToLogicalType(target, root, depth + 1) : YAMLTypes::YAMLType();
+	}
+	if (GetSchemaFlag(schema, "x-kubernetes-int-or-string")) {
+		return LogicalType::VARCHAR;
+	}
+
+	auto type_name = GetSchemaTypeName(schema);
+	auto properties = GetSchemaKey(schema, "properties");
+	auto items = GetSchemaKey(schema, "items");
+	if (type_name.empty()) {
+		if (properties.IsDefined()) {
+			type_name = "object";
+		} else if (items.IsDefined()) {
+			type_name = "array";
+		}
+	}
+
+	auto enum_values = GetSchemaKey(schema, "enum");
+	if (enum_values.IsDefined() && enum_values.IsSequence() && (type_name.empty() || type_name == "string")) {
+		return SchemaEnumType(enum_values);
+	}
+
+	if (type_name == "string") {
+		auto format = GetSchemaString(schema, "format");
+		if (format == "date") {
+			return LogicalType::DATE;
+		} else if (format == "date-time") {
+			return LogicalType::TIMESTAMP;
+		} else if (format == "time") {
+			return LogicalType::TIME;
+		}
+		return LogicalType::VARCHAR;
+	} else if (type_name == "integer") {
+		return GetSchemaString(schema, "format") == "int32" ? LogicalType::INTEGER : LogicalType::BIGINT;
+	} else if (type_name == "number") {
+		return LogicalType::DOUBLE;
+	} else if (type_name == "boolean") {
+		return LogicalType::BOOLEAN;
+	} else if (type_name == "array") {
+		if (!items.IsDefined()) {
+			return LogicalType::LIST(YAMLTypes::YAMLType());
+		}
+		return LogicalType::LIST(SchemaToLogicalType(items, root, depth + 1));
+	} else if (type_name == "object") {
+		if (properties.IsMap() && properties.size() > 0) {
+			child_list_t<LogicalType> children;
+			for (auto it = properties.begin(); it != properties.end(); ++it) {
+				children.push_back(make_pair(it->first.Scalar(), SchemaToLogicalType(it->second, root, depth + 1)));
+			}
+			return LogicalType::STRUCT(children);
+		}
+		// Free-form maps: typed values become a MAP, anything else stays YAML
+		auto additional = GetSchemaKey(schema, "additionalProperties");
+		if (additional.IsMap() && !GetSchemaFlag(schema, "x-kubernetes-preserve-unknown-fields")) {
+			return LogicalType::MAP(LogicalType::VARCHAR, SchemaToLogicalType(additional, root, depth + 1));
+		}
+	}
+	// No type, oneOf/anyOf/allOf, "null", preserved unknown fields
+	return YAMLTypes::YAMLType();
+}
+
+// Locate the record schema in a schema document: a Kubernetes CRD (storage version), an
+// object carrying openAPIV3Schema, or a plain JSON Schema
+static YAML::Node FindRecordSchema(const YAML::Node &doc) {
+	if (GetSchemaString(doc, "kind") == "CustomResourceDefinition") {
+		auto spec = GetSchemaKey(doc, "spec");
+		auto versions = GetSchemaKey(spec, "versions");
+		if (versions.IsSequence() && versions.size() > 0) {
+			YAML::Node version;
+			version.reset(versions[0]);
+			for (auto it = versions.begin(); it != versions.end(); ++it) {
+				if (GetSchemaFlag(*it, "storage")) {
+					version.reset(*it);
+					break;
+				}
+			}
+			return GetSchemaKey(GetSchemaKey(version, "schema"), "openAPIV3Schema");
+		}
+		// apiextensions.k8s.io/v1beta1
+		return GetSchemaKey(GetSchemaKey(spec, "validation"), "openAPIV3Schema");
+	}
+	auto openapi = GetSchemaKey(doc, "openAPIV3Schema");
+	if (openapi.IsDefined()) {
+		return openapi;
+	}
+	return doc;
+}
+
+void YAMLReader::BindSchemaFile(ClientContext &context, const string &schema_file, vector<string> &names,
+                                vector<LogicalType> &types) {
+	// JSON is valid YAML, so .json and .yaml schema files are read the same way
+	auto docs = ReadYAMLFile(context, schema_file, YAMLReadOptions());
+
+	for (auto &doc : docs) {
+		auto schema = FindRecordSchema(doc);
+		if (!schema.IsMap()) {
+			continue;
+		}
+		// A schema for a list of records describes its items
+		if (GetSchemaTypeName(schema) == "array") {
+			auto items = GetSchemaKey(schema, "items");
+			auto ref = GetSchemaString(items, "$ref");
+			schema.reset(ref.empty() ? items : ResolveSchemaRef(doc, ref));
+		}
+		auto properties = GetSchemaKey(schema, "properties");
+		if (!properties.IsMap() || properties.size() == 0) {
+			continue;
+		}
+		for (auto it = properties.begin(); it != properties.end(); ++it) {
+			names.push_back(it->first.Scalar());
+			types.push_back(SchemaToLogicalType(it->second, doc, 0));
+		}
+		return;
+	}
+	throw BinderException("schema_file '" + schema_file + "' does not describe an object with properties");
+}
+
 } // namespace duckdb
@@ -8,6 +8,8 @@
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/function/scalar_function.hpp"
+#include "yaml_extension.hpp"
+#include "yaml_reader.hpp"
 #include "yaml_types.hpp"
 #include "yaml_utils.hpp"
 #include "yaml_formatting.hpp"
@@ -28,6 +30,7 @@ static BoundStatement CopyToYAMLPlan(Binder &binder, CopyStatement &stmt) {
 	string yaml_layout = "";    // Default to empty, will infer from style
 	string yaml_multiline = ""; // Default to empty, will resolve to "auto"
 	string yaml_indent = "";    // Default to empty, will use "2"
+	bool yaml_deduplicate = false;
 	case_insensitive_map_t<vector<Value>> csv_copy_options {{"file_extension", {"yaml"}}};
 
 	for (const auto &kv : copied_info.options) {
@@ -78,6 +81,13 @@ static BoundStatement CopyToYAMLPlan(Binder &binder, CopyStatement &stmt) {
 				throw BinderException("Invalid YAML indent '%s'. Must be an integer between 1 and 10.",
 				                      yaml_indent.c_str());
 			}
+		} else if (loption == "deduplicate") {
+			if (kv.second.size() > 1) {
+				ThrowYAMLCopyParameterException(loption);
+			}
+			// A bare DEDUPLICATE option turns deduplication on
+			yaml_deduplicate =
+			    kv.second.empty() || BooleanValue::Get(kv.second.back().DefaultCastAs(LogicalType::BOOLEAN));
 		} else if (loption == "compression" || loption == "encoding" || loption == "per_thread_output" ||
 		           loption == "file_size_bytes" || loption == "use_tmp_file" || loption == "overwrite_or_ignore" ||
 		           loption == "filename_pattern" || loption == "file_extension") {
@@ -136,7 +146,7 @@ static BoundStatement CopyToYAMLPlan(Binder &binder, CopyStatement &stmt) {
 	internal_layout_value->SetAlias("layout");
 	format_yaml_children.emplace_back(std::move(internal_layout_value));
 
-	// Add the target layout, style, multiline, and indent as trailing positional args
+	// Add the target layout, style, multiline, indent, and deduplicate as trailing positional args
 	if (!yaml_layout.empty()) {
 		auto target_layout_value = make_uniq<ConstantExpression>(yaml_layout);
 		format_yaml_children.emplace_back(std::move(target_layout_value));
@@ -171,6 +181,9 @@ static BoundStatement CopyToYAMLPlan(Binder &binder, CopyStatement &stmt) {
 		format_yaml_children.emplace_back(std::move(indent_value));
 	}
 
+	// Anchor/alias deduplication of repeated nested values
+	format_yaml_children.emplace_back(make_uniq<ConstantExpression>(Value::BOOLEAN(yaml_deduplicate)));
+
 	// Create copy_format_yaml function call (we'll register this function to handle post-processing)
 	select_node.select_list.emplace_back(
 	    make_uniq<FunctionExpression>("copy_format_yaml", std::move(format_yaml_children)));
@@ -193,12 +206,13 @@ static BoundStatement CopyToYAMLPlan(Binder &binder, CopyStatement &stmt) {
 static void CopyFormatYAMLFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	auto &input = args.data[0];
 
-	// Get trailing positional args: layout, style, multiline, indent (last 4)
+	// Get trailing positional args: layout, style, multiline, indent, deduplicate (last 5)
 	auto col_count = args.ColumnCount();
-	Value target_layout_value = args.data[col_count - 4].GetValue(0);
-	Value target_style_value = args.data[col_count - 3].GetValue(0);
-	Value target_multiline_value = args.data[col_count - 2].GetValue(0);
-	Value target_indent_value = args.data[col_count - 1].GetValue(0);
+	Value target_layout_value = args.data[col_count - 5].GetValue(0);
+	Value target_style_value = args.data[col_count - 4].GetValue(0);
+	Value target_multiline_value = args.data[col_count - 3].GetValue(0);
+	Value target_indent_value = args.data[col_count - 2].GetValue(0);
+	bool deduplicate = BooleanValue::Get(args.data[col_count - 1].GetValue(0));
 
 	string target_layout_str = StringUtil::Lower(target_layout_value.ToString());
 	string target_style = StringUtil::Lower(target_style_value.ToString());
@@ -233,7 +247,7 @@ static void CopyFormatYAMLFunction(DataChunk &args, ExpressionState &state, Vect
 
 		try {
 			// Get the base YAML string with string style and indent
-			std::string yaml_str = yaml_utils::ValueToYAMLString(value, format, string_style, indent);
+			std::string yaml_str = yaml_utils::ValueToYAMLString(value, format, string_style, indent, deduplicate);
 
 			// Apply layout-specific formatting
 			yaml_str = yaml_formatting::PostProcessForLayout(yaml_str, layout, format, row_idx);
@@ -248,11 +262,8 @@ static void CopyFormatYAMLFunction(DataChunk &args, ExpressionState &state, Vect
 }
 
 void RegisterYAMLCopyFunctions(ExtensionLoader &loader) {
-	// Register the COPY TO function
-	auto copy_function = CopyFunction("yaml");
-	copy_function.extension = "yaml";
-	copy_function.plan = CopyToYAMLPlan;
-	loader.RegisterFunction(copy_function);
+	// Register the COPY TO / COPY FROM function
+	loader.RegisterFunction(GetYAMLCopyFunction());
 
 	// Register copy_format_yaml function for COPY TO post-processing
 	auto copy_format_yaml_fun =
@@ -268,8 +279,9 @@ CopyFunction GetYAMLCopyFunction() {
 
 	function.plan = CopyToYAMLPlan;
 
-	// Note: We don't implement copy_from_bind or copy_from_function here
-	// because YAML reading is handled by read_yaml table functions
+	// COPY ... FROM scans with read_yaml, typed by the target table
+	function.copy_from_bind = YAMLReader::YAMLCopyFromBind;
+	function.copy_from_function = YAMLReader::GetReadYAMLFunction();
 
 	return function;
 }
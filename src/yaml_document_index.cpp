@@ -0,0 +1,374 @@
+#include "yaml_document_index.hpp"
+#include "yaml_reader.hpp"
+#include "yaml_extension.hpp"
+#include "duckdb_compat.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/function/table_function.hpp"
+#include <cstring>
+
+namespace duckdb {
+
+// Chunk size used when scanning a file for document boundaries
+static constexpr idx_t SCAN_BUFFER_SIZE = 1 << 20;
+// Only the start of a line is needed to classify it, so lines split across chunks
+// are carried over up to this many bytes (keeps memory flat for huge flow-style lines)
+static constexpr idx_t MAX_CARRY_SIZE = 4096;
+
+//===--------------------------------------------------------------------===//
+// Boundary scanner
+//===--------------------------------------------------------------------===//
+
+// "---" / "..." at column 0 followed by whitespace or end of line
+static bool IsMarkerLine(const char *line, idx_t len, char marker) {
+	if (len < 3 || line[0] != marker || line[1] != marker || line[2] != marker) {
+		return false;
+	}
+	return len == 3 || line[3] == ' ' || line[3] == '\t';
+}
+
+static idx_t SkipBlanks(const char *line, idx_t len, idx_t pos) {
+	while (pos < len && (line[pos] == ' ' || line[pos] == '\t')) {
+		pos++;
+	}
+	return pos;
+}
+
+static idx_t SkipToken(const char *line, idx_t len, idx_t pos) {
+	while (pos < len && line[pos] != ' ' && line[pos] != '\t') {
+		pos++;
+	}
+	return pos;
+}
+
+void YAMLDocumentScanner::Feed(const char *data, idx_t size) {
+	idx_t pos = 0;
+	while (pos < size) {
+		auto newline = static_cast<const char *>(memchr(data + pos, '\n', size - pos));
+		idx_t line_len = newline ? idx_t(newline - (data + pos)) : size - pos;
+		if (!newline || carry_active) {
+			// Line spans a chunk boundary: keep its prefix until the rest arrives
+			if (!carry_active) {
+				carry_active = true;
+				carry_offset = consumed + pos;
+			}
+			if (carry.size() < MAX_CARRY_SIZE) {
+				carry.append(data + pos, MinValue<idx_t>(line_len, MAX_CARRY_SIZE - carry.size()));
+			}
+			if (!newline) {
+				break;
+			}
+			ProcessLine(carry.data(), carry.size(), carry_offset, consumed + pos + line_len + 1);
+			carry.clear();
+			carry_active = false;
+		} else {
+			ProcessLine(data + pos, line_len, consumed + pos, consumed + pos + line_len + 1);
+		}
+		pos += line_len + 1;
+	}
+	consumed += size;
+}
+
+void YAMLDocumentScanner::Finish() {
+	if (carry_active) {
+		ProcessLine(carry.data(), carry.size(), carry_offset, consumed);
+		carry.clear();
+		carry_active = false;
+	}
+	if (in_document) {
+		// Closed by the end of the data - may still be growing
+		CloseDocument(consumed, false);
+	}
+}
+
+void YAMLDocumentScanner::ProcessLine(const char *line, idx_t len, idx_t line_offset, idx_t next_offset) {
+	if (len > 0 && line[len - 1] == '\r') {
+		len--;
+	}
+	// Skip a UTF-8 byte order mark on the first line
+	if (line_offset == 0 && len >= 3 && static_cast<unsigned char>(line[0]) == 0xEF &&
+	    static_cast<unsigned char>(line[1]) == 0xBB && static_cast<unsigned char>(line[2]) == 0xBF) {
+		line += 3;
+		len -= 3;
+	}
+
+	if (IsMarkerLine(line, len, '-')) {
+		if (in_document) {
+			CloseDocument(line_offset, true);
+		}
+		OpenDocument(has_pending ? pending_start : line_offset, line_offset, line, len);
+		return;
+	}
+	if (IsMarkerLine(line, len, '.')) {
+		// Explicit document end: the marker line belongs to the document it closes
+		if (in_document) {
+			CloseDocument(next_offset, true);
+		}
+		has_pending = false;
+		pending_directives = false;
+		return;
+	}
+	if (in_document) {
+		return;
+	}
+
+	// Between documents: directives, comments and blank lines are attached to the next document
+	auto first = SkipBlanks(line, len, 0);
+	if (first == len || line[first] == '#' || line[0] == '%') {
+		if (!has_pending) {
+			has_pending = true;
+			pending_start = line_offset;
+		}
+		pending_directives = pending_directives || line[0] == '%';
+		return;
+	}
+
+	// Any other content starts a document without an explicit "---" header
+	OpenDocument(has_pending ? pending_start : line_offset, line_offset, nullptr, 0);
+}
+
+void YAMLDocumentScanner::OpenDocument(idx_t start, idx_t header_offset, const char *header, idx_t header_len) {
+	YAMLDocumentSpan span;
+	span.byte_offset = start;
+	if (pending_directives) {
+		// Replaces the directives in effect, for this and the following documents
+		directives_offset = start;
+		directives_length = header_offset - start;
+		pending_directives = false;
+	}
+	span.directives_offset = directives_offset;
+	span.directives_length = directives_length;
+	if (header) {
+		// "--- [!tag] [&anchor] ..." - same header grammar as StripDocumentSuffixes
+		auto pos = SkipBlanks(header, header_len, 3);
+		if (pos < header_len && header[pos] == '!') {
+			auto end = SkipToken(header, header_len, pos);
+			span.tag = string(header + pos, end - pos);
+			pos = SkipBlanks(header, header_len, end);
+		}
+		if (pos < header_len && header[pos] == '&') {
+			auto end = SkipToken(header, header_len, pos);
+			span.anchor = string(header + pos + 1, end - pos - 1);
+		}
+	}
+	spans.push_back(std::move(span));
+	in_document = true;
+	has_pending = false;
+}
+
+void YAMLDocumentScanner::CloseDocument(idx_t end, bool terminated) {
+	auto &span = spans.back();
+	span.byte_length = end - span.byte_offset;
+	span.terminated = terminated;
+	in_document = false;
+}
+
+//===--------------------------------------------------------------------===//
+// Document index
+//===--------------------------------------------------------------------===//
+
+// Split keeping empty fields (tag and anchor columns are often empty)
+static vector<string> SplitFields(const string &input, char delimiter) {
+	vector<string> result;
+	idx_t start = 0;
+	while (true) {
+		auto pos = input.find(delimiter, start);
+		if (pos == string::npos) {
+			result.push_back(input.substr(start));
+			return result;
+		}
+		result.push_back(input.substr(start, pos - start));
+		start = pos + 1;
+	}
+}
+
+string YAMLDocumentIndex::SidecarPath(const string &file_path) {
+	return file_path + SIDECAR_SUFFIX;
+}
+
+vector<YAMLDocumentSpan> YAMLDocumentIndex::Scan(FileHandle &handle) {
+	YAMLDocumentScanner scanner;
+	auto file_size = handle.GetFileSize();
+	auto buffer = make_unsafe_uniq_array<char>(SCAN_BUFFER_SIZE);
+	idx_t offset = 0;
+	while (offset < file_size) {
+		auto chunk_size = MinValue<idx_t>(SCAN_BUFFER_SIZE, file_size - offset);
+		handle.Read(buffer.get(), chunk_size, offset);
+		scanner.Feed(buffer.get(), chunk_size);
+		offset += chunk_size;
+	}
+	scanner.Finish();
+	return std::move(scanner.spans);
+}
+
+bool YAMLDocumentIndex::TryReadSidecar(FileSystem &fs, const string &sidecar_path, idx_t file_size, int64_t file_mtime,
+                                       vector<YAMLDocumentSpan> &spans) {
+	if (!fs.FileExists(sidecar_path)) {
+		return false;
+	}
+	try {
+		auto handle = fs.OpenFile(sidecar_path, FileFlags::FILE_FLAGS_READ);
+		auto size = fs.GetFileSize(*handle);
+		string content;
+		content.resize(size);
+		handle->Read((void *)content.data(), size);
+
+		auto lines = SplitFields(content, '\n');
+		auto header = SplitFields(lines[0], '\t');
+		if (header.size() != 4 || header[0] != "yidx" || header[1] != "2" || std::stoull(header[2]) != file_size ||
+		    std::stoll(header[3]) != file_mtime) {
+			// Stale or foreign sidecar - rescan instead
+			return false;
+		}
+		vector<YAMLDocumentSpan> result;
+		for (idx_t i = 1; i < lines.size(); i++) {
+			if (lines[i].empty()) {
+				continue;
+			}
+			auto fields = SplitFields(lines[i], '\t');
+			if (fields.size() != 6) {
+				return false;
+			}
+			YAMLDocumentSpan span;
+			span.byte_offset = std::stoull(fields[0]);
+			span.byte_length = std::stoull(fields[1]);
+			span.tag = fields[2];
+			span.anchor = fields[3];
+			span.directives_offset = std::stoull(fields[4]);
+			span.directives_length = std::stoull(fields[5]);
+			if (span.byte_offset + span.byte_length > file_size ||
+			    span.directives_offset + span.directives_length > file_size) {
+				return false;
+			}
+			result.push_back(std::move(span));
+		}
+		spans = std::move(result);
+		return true;
+	} catch (const std::exception &) {
+		// Unreadable or malformed sidecar - fall back to scanning the data file
+		return false;
+	}
+}
+
+void YAMLDocumentIndex::WriteSidecar(FileSystem &fs, const string &sidecar_path, idx_t file_size, int64_t file_mtime,
+                                     const vector<YAMLDocumentSpan> &spans) {
+	// Version 2 added the directive block columns; older sidecars are rescanned
+	string content = "yidx\t2\t" + to_string(file_size) + "\t" + to_string(file_mtime) + "\n";
+	for (auto &span : spans) {
+		content += to_string(span.byte_offset) + "\t" + to_string(span.byte_length) + "\t" + span.tag + "\t" +
+		           span.anchor + "\t" + to_string(span.directives_offset) + "\t" +
+		           to_string(span.directives_length) + "\n";
+	}
+	auto handle = fs.OpenFile(sidecar_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+	handle->Write((void *)content.data(), content.size());
+	handle->Sync();
+}
+
+vector<YAMLDocumentSpan> YAMLDocumentIndex::Load(FileSystem &fs, FileHandle &handle, const string &file_path,
+                                                 bool write_sidecar) {
+	auto file_size = fs.GetFileSize(handle);
+	int64_t file_mtime = fs.GetLastModifiedTime(handle).value;
+	auto sidecar_path = SidecarPath(file_path);
+
+	vector<YAMLDocumentSpan> spans;
+	if (TryReadSidecar(fs, sidecar_path, file_size, file_mtime, spans)) {
+		return spans;
+	}
+	spans = Scan(handle);
+	if (write_sidecar) {
+		WriteSidecar(fs, sidecar_path, file_size, file_mtime, spans);
+	}
+	return spans;
+}
+
+//===--------------------------------------------------------------------===//
+// yaml_document_index table function
+//===--------------------------------------------------------------------===//
+
+// Bind data for yaml_document_index
+struct YAMLDocumentIndexBindData : public TableFunctionData {
+	vector<string> file_paths;
+	bool write_index = false; // Persist the scanned index as a .yidx sidecar
+};
+
+// Local state for yaml_document_index
+struct YAMLDocumentIndexLocalState : public LocalTableFunctionState {
+	idx_t current_file = 0;
+	vector<YAMLDocumentSpan> spans; // Spans of the file before current_file
+	idx_t current_span = 0;
+};
+
+static unique_ptr<FunctionData> YAMLDocumentIndexBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	auto result = make_uniq<YAMLDocumentIndexBindData>();
+
+	if (input.inputs.empty()) {
+		throw BinderException("yaml_document_index requires a file path parameter");
+	}
+	result->file_paths = YAMLReader::GetFiles(context, input.inputs[0], false);
+	if (result->file_paths.empty()) {
+		throw BinderException("No files found matching the provided path");
+	}
+
+	for (auto &kv : input.named_parameters) {
+		auto kv_name = CompatIdentifierName(kv.first);
+		if (kv_name == "write_index") {
+			result->write_index = BooleanValue::Get(kv.second);
+		}
+	}
+
+	names = {"filename", "doc_index", "byte_offset", "byte_length", "tag", "anchor"};
+	return_types = {LogicalType::VARCHAR, LogicalType::BIGINT,  LogicalType::BIGINT,
+	                LogicalType::BIGINT,  LogicalType::VARCHAR, LogicalType::VARCHAR};
+
+	return std::move(result);
+}
+
+static unique_ptr<LocalTableFunctionState> YAMLDocumentIndexInit(ExecutionContext &context,
+                                                                 TableFunctionInitInput &input,
+                                                                 GlobalTableFunctionState *global_state) {
+	return make_uniq<YAMLDocumentIndexLocalState>();
+}
+
+static void YAMLDocumentIndexFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<YAMLDocumentIndexBindData>();
+	auto &state = data_p.local_state->Cast<YAMLDocumentIndexLocalState>();
+	auto &fs = FileSystem::GetFileSystem(context);
+
+	output.Reset();
+	idx_t count = 0;
+	while (count < STANDARD_VECTOR_SIZE) {
+		if (state.current_span >= state.spans.size()) {
+			if (state.current_file >= bind_data.file_paths.size()) {
+				break;
+			}
+			auto &file_path = bind_data.file_paths[state.current_file++];
+			auto handle = fs.OpenFile(file_path, FileFlags::FILE_FLAGS_READ);
+			state.spans = YAMLDocumentIndex::Load(fs, *handle, file_path, bind_data.write_index);
+			state.current_span = 0;
+			continue;
+		}
+
+		auto &span = state.spans[state.current_span];
+		output.SetValue(0, count, Value(bind_data.file_paths[state.current_file - 1]));
+		output.SetValue(1, count, Value::BIGINT(NumericCast<int64_t>(state.current_span)));
+		output.SetValue(2, count, Value::BIGINT(NumericCast<int64_t>(span.byte_offset)));
+		output.SetValue(3, count, Value::BIGINT(NumericCast<int64_t>(span.byte_length)));
+		output.SetValue(4, count, span.tag.empty() ? Value(LogicalType::VARCHAR) : Value(span.tag));
+		output.SetValue(5, count, span.anchor.empty() ? Value(LogicalType::VARCHAR) : Value(span.anchor));
+		state.current_span++;
+		count++;
+	}
+
+	CompatSetOutputCardinality(output, count);
+}
+
+void RegisterYAMLDocumentIndexFunction(ExtensionLoader &loader) {
+	TableFunction yaml_document_index("yaml_document_index", {LogicalType::ANY}, YAMLDocumentIndexFunction,
+	                                  YAMLDocumentIndexBind);
+	yaml_document_index.init_local = YAMLDocumentIndexInit;
+	yaml_document_index.named_parameters["write_index"] = LogicalType::BOOLEAN;
+
+	loader.RegisterFunction(yaml_document_index);
+}
+
+} // namespace duckdb
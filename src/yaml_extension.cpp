@@ -38,6 +38,9 @@ static void LoadInternal(ExtensionLoader &loader) {
 	// Register YAML frontmatter reader
 	RegisterYAMLFrontmatterFunction(loader);
 
+	// Register YAML document offset index scan
+	RegisterYAMLDocumentIndexFunction(loader);
+
 	// Register YAML files as automatically recognized by DuckDB
 	auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
 
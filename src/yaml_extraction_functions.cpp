@@ -115,6 +115,41 @@ static YAML::Node ExtractFromYAML(const YAML::Node &node, const vector<string> &
 	return ExtractFromYAML(child, path_components, index + 1);
 }
 
+// The marks of the node ExtractFromYAML finds for the same path, or nullptr when the path
+// passes through an alias (aliases have no marks for their children)
+static const yaml_utils::YAMLSourceMarks *FindSourceMarks(const YAML::Node &node,
+                                                         const yaml_utils::YAMLSourceMarks &marks,
+                                                         const vector<string> &path_components, size_t index = 0) {
+	if (index >= path_components.size()) {
+		return &marks;
+	}
+
+	const string &component = path_components[index];
+	if (!component.empty() && component[0] == '[') {
+		size_t arr_index = std::stoul(component.substr(1, component.length() - 2));
+		if (!node.IsSequence() || arr_index >= node.size() || arr_index >= marks.children.size()) {
+			return nullptr;
+		}
+		return FindSourceMarks(node[arr_index], marks.children[arr_index], path_components, index + 1);
+	}
+
+	if (!node.IsMap()) {
+		return nullptr;
+	}
+	// Map lookups return the first entry with a matching key
+	idx_t entry_idx = 0;
+	for (auto it = node.begin(); it != node.end(); ++it, entry_idx++) {
+		YAML::Node key = it->first;
+		if (key.IsScalar() && key.Scalar() == component) {
+			if (entry_idx >= marks.children.size()) {
+				return nullptr;
+			}
+			return FindSourceMarks(it->second, marks.children[entry_idx], path_components, index + 1);
+		}
+	}
+	return nullptr;
+}
+
 //===--------------------------------------------------------------------===//
 // YAML Type Functions
 //===--------------------------------------------------------------------===//
@@ -126,7 +161,7 @@ static void YAMLTypeUnaryFunction(DataChunk &args, ExpressionState &state, Vecto
 		}
 
 		try {
-			YAML::Node node = YAML::Load(yaml_str.GetString());
+			YAML::Node node = yaml_utils::LoadYAML(yaml_str.GetString());
 			string type_str;
 
 			switch (node.Type()) {
@@ -164,7 +199,7 @@ static void YAMLTypeBinaryFunction(DataChunk &args, ExpressionState &state, Vect
 		    }
 
 		    try {
-			    YAML::Node root = YAML::Load(yaml_str.GetString());
+			    YAML::Node root = yaml_utils::LoadYAML(yaml_str.GetString());
 			    auto path_components = ParseYAMLPath(path_str.GetString());
 			    auto node = ExtractFromYAML(root, path_components);
 
@@ -211,7 +246,9 @@ static void YAMLExtractFunction(DataChunk &args, ExpressionState &state, Vector
 		    }
 
 		    try {
-			    YAML::Node root = YAML::Load(yaml_str.GetString());
+			    auto input = yaml_str.GetString();
+			    yaml_utils::YAMLSourceMarks marks;
+			    YAML::Node root = yaml_utils::LoadYAML(input, marks);
 			    auto path_components = ParseYAMLPath(path_str.GetString());
 			    auto node = ExtractFromYAML(root, path_components);
 
@@ -220,13 +257,9 @@ static void YAMLExtractFunction(DataChunk &args, ExpressionState &state, Vector
 				    return string_t();
 			    }
 
-			    YAML::Emitter out;
-			    out.SetIndent(2);
-			    out.SetMapFormat(YAML::Flow);
-			    out.SetSeqFormat(YAML::Flow);
-			    out << node;
-
-			    string yaml_result = out.c_str();
+			    // Collections are copied out of the input rather than re-serialized
+			    auto node_marks = FindSourceMarks(root, marks, path_components);
+			    string yaml_result = yaml_utils::YAMLNodeSourceText(input, node, node_marks);
 			    return StringVector::AddString(result, yaml_result.c_str(), yaml_result.length());
 		    } catch (const std::exception &e) {
 			    throw InvalidInputException("Error in yaml_extract: %s", e.what());
@@ -244,7 +277,7 @@ static void YAMLExtractStringFunction(DataChunk &args, ExpressionState &state, V
 		    }
 
 		    try {
-			    YAML::Node root = YAML::Load(yaml_str.GetString());
+			    YAML::Node root = yaml_utils::LoadYAML(yaml_str.GetString());
 			    auto path_components = ParseYAMLPath(path_str.GetString());
 			    auto node = ExtractFromYAML(root, path_components);
 
@@ -289,7 +322,7 @@ static void YAMLExistsFunction(DataChunk &args, ExpressionState &state, Vector &
 		    }
 
 		    try {
-			    YAML::Node root = YAML::Load(yaml_str.GetString());
+			    YAML::Node root = yaml_utils::LoadYAML(yaml_str.GetString());
 			    auto path_components = ParseYAMLPath(path_str.GetString());
 			    auto node = ExtractFromYAML(root, path_components);
 
@@ -457,6 +490,7 @@ static string BuildYAMLStructure(const YAML::Node &node) {
 }
 
 static void YAMLStructureFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(state.GetContext());
 	UnaryExecutor::Execute<string_t, string_t>(args.data[0], result, args.size(), [&](string_t yaml_str) -> string_t {
 		if (yaml_str.GetSize() == 0) {
 			return StringVector::AddString(result, "\"NULL\"");
@@ -464,7 +498,7 @@ static void YAMLStructureFunction(DataChunk &args, ExpressionState &state, Vecto
 
 		try {
 			yaml_utils::CheckInputSize(yaml_str.GetSize(), "yaml_structure");
-			YAML::Node root = YAML::Load(yaml_str.GetString());
+			YAML::Node root = yaml_utils::LoadYAML(yaml_str.GetString());
 			yaml_utils::CheckExpansionBudget(root);
 			string structure = BuildYAMLStructure(root);
 			return StringVector::AddString(result, structure);
@@ -472,6 +506,7 @@ static void YAMLStructureFunction(DataChunk &args, ExpressionState &state, Vecto
 			throw InvalidInputException("Error in yaml_structure: %s", e.what());
 		}
 	});
+	yaml_utils::CheckInterrupted();
 }
 
 //===--------------------------------------------------------------------===//
@@ -551,13 +586,14 @@ static bool YAMLNodeContains(const YAML::Node &haystack, const YAML::Node &needl
 }
 
 static void YAMLContainsFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(state.GetContext());
 	BinaryExecutor::Execute<string_t, string_t, bool>(
 	    args.data[0], args.data[1], result, args.size(), [&](string_t haystack_str, string_t needle_str) -> bool {
 		    try {
 			    yaml_utils::CheckInputSize(haystack_str.GetSize(), "yaml_contains");
 			    yaml_utils::CheckInputSize(needle_str.GetSize(), "yaml_contains");
-			    YAML::Node haystack = YAML::Load(haystack_str.GetString());
-			    YAML::Node needle = YAML::Load(needle_str.GetString());
+			    YAML::Node haystack = yaml_utils::LoadYAML(haystack_str.GetString());
+			    YAML::Node needle = yaml_utils::LoadYAML(needle_str.GetString());
 			    // Bound expansion before the (unbounded) recursive containment walk.
 			    yaml_utils::CheckExpansionBudget(haystack);
 			    return YAMLNodeContains(haystack, needle);
@@ -567,6 +603,268 @@ static void YAMLContainsFunction(DataChunk &args, ExpressionState &state, Vector
 			    return false;
 		    }
 	    });
+	yaml_utils::CheckInterrupted();
+}
+
+//===--------------------------------------------------------------------===//
+// YAML Diff Functions
+//===--------------------------------------------------------------------===//
+
+static string NodeToFlowYAML(const YAML::Node &node) {
+	YAML::Emitter out;
+	out.SetIndent(2);
+	out.SetMapFormat(YAML::Flow);
+	out.SetSeqFormat(YAML::Flow);
+	out << node;
+	return out.c_str();
+}
+
+static string MapKeyText(const YAML::Node &key) {
+	return key.IsScalar() ? key.Scalar() : NodeToFlowYAML(key);
+}
+
+//! One difference between two documents; a missing side is an undefined node
+struct YAMLDiffEntry {
+	string path;
+	const char *op;
+	YAML::Node old_node;
+	YAML::Node new_node;
+};
+
+/**
+ * @brief Structural comparison of two parsed documents
+ *
+ * Both trees are walked in lockstep. Mapping entries are paired positionally while both
+ * sides list the same keys in the same order, and by a hash lookup on the key once they
+ * diverge, so reordered keys are not reported as differences. Paths use the "$.key[0]"
+ * syntax accepted by yaml_extract. Without an entry list the walk stops at the first
+ * difference.
+ */
+class YAMLDiffWalker {
+public:
+	explicit YAMLDiffWalker(vector<YAMLDiffEntry> *entries_p = nullptr) : entries(entries_p) {
+	}
+
+	//! Whether the documents differ
+	bool Diff(const YAML::Node &old_node, const YAML::Node &new_node) {
+		path = "$";
+		return DiffNodes(old_node, new_node);
+	}
+
+private:
+	bool Report(const char *op, const YAML::Node &old_node, const YAML::Node &new_node) {
+		if (entries) {
+			entries->push_back({path, op, old_node, new_node});
+		}
+		return true;
+	}
+
+	void AppendKey(idx_t path_length, const string &key) {
+		path.resize(path_length);
+		yaml_utils::AppendYAMLPathKey(path, key);
+	}
+
+	void AppendIndex(idx_t path_length, idx_t index) {
+		path.resize(path_length);
+		path += '[';
+		path += std::to_string(index);
+		path += ']';
+	}
+
+	bool DiffNodes(const YAML::Node &old_node, const YAML::Node &new_node) {
+		if (old_node.Type() != new_node.Type()) {
+			return Report("replace", old_node, new_node);
+		}
+		switch (old_node.Type()) {
+		case YAML::NodeType::Scalar:
+			// The tag decides the type: "1", !!str 1 and 1 have the same text but differ
+			if (old_node.Scalar() == new_node.Scalar() && old_node.Tag() == new_node.Tag()) {
+				return false;
+			}
+			return Report("replace", old_node, new_node);
+		case YAML::NodeType::Sequence:
+			return DiffSequences(old_node, new_node);
+		case YAML::NodeType::Map:
+			return DiffMaps(old_node, new_node);
+		default:
+			return false;
+		}
+	}
+
+	bool DiffSequences(const YAML::Node &old_node, const YAML::Node &new_node) {
+		if (!entries && old_node.size() != new_node.size()) {
+			return true;
+		}
+		auto path_length = path.size();
+		bool differs = false;
+		auto old_it = old_node.begin();
+		auto new_it = new_node.begin();
+		for (idx_t index = 0; old_it != old_node.end() || new_it != new_node.end(); index++) {
+			AppendIndex(path_length, index);
+			if (new_it == new_node.end()) {
+				differs = Report("remove", *old_it++, YAML::Node(YAML::NodeType::Undefined));
+			} else if (old_it == old_node.end()) {
+				differs = Report("add", YAML::Node(YAML::NodeType::Undefined), *new_it++);
+			} else if (DiffNodes(*old_it++, *new_it++)) {
+				differs = true;
+			}
+			if (differs && !entries) {
+				break;
+			}
+		}
+		path.resize(path_length);
+		return differs;
+	}
+
+	bool DiffMaps(const YAML::Node &old_node, const YAML::Node &new_node) {
+		if (!entries && old_node.size() != new_node.size()) {
+			return true;
+		}
+		auto path_length = path.size();
+		bool differs = false;
+
+		// Lockstep while both sides have the same keys in the same order
+		auto old_it = old_node.begin();
+		auto new_it = new_node.begin();
+		for (; old_it != old_node.end() && new_it != new_node.end(); ++old_it, ++new_it) {
+			auto key = MapKeyText(old_it->first);
+			if (key != MapKeyText(new_it->first)) {
+				break;
+			}
+			AppendKey(path_length, key);
+			if (DiffNodes(old_it->second, new_it->second)) {
+				differs = true;
+				if (!entries) {
+					path.resize(path_length);
+					return true;
+				}
+			}
+		}
+
+		// Pair up the remaining entries by key
+		vector<pair<string, YAML::Node>> remaining;
+		unordered_map<string, idx_t> remaining_index;
+		for (; new_it != new_node.end(); ++new_it) {
+			auto key = MapKeyText(new_it->first);
+			remaining_index.emplace(key, remaining.size());
+			remaining.emplace_back(std::move(key), new_it->second);
+		}
+		vector<bool> matched(remaining.size(), false);
+		for (; old_it != old_node.end() && (!differs || entries); ++old_it) {
+			auto key = MapKeyText(old_it->first);
+			AppendKey(path_length, key);
+			auto entry = remaining_index.find(key);
+			if (entry == remaining_index.end() || matched[entry->second]) {
+				differs = Report("remove", old_it->second, YAML::Node(YAML::NodeType::Undefined));
+			} else {
+				matched[entry->second] = true;
+				differs = DiffNodes(old_it->second, remaining[entry->second].second) || differs;
+			}
+		}
+		for (idx_t new_idx = 0; new_idx < remaining.size() && (!differs || entries); new_idx++) {
+			if (!matched[new_idx]) {
+				AppendKey(path_length, remaining[new_idx].first);
+				differs = Report("add", YAML::Node(YAML::NodeType::Undefined), remaining[new_idx].second);
+			}
+		}
+		path.resize(path_length);
+		return differs;
+	}
+
+	vector<YAMLDiffEntry> *entries;
+	string path;
+};
+
+static void LoadDiffInputs(const string_t &old_str, const string_t &new_str, const char *function_name,
+                           YAML::Node &old_node, YAML::Node &new_node) {
+	yaml_utils::CheckInputSize(old_str.GetSize(), function_name);
+	yaml_utils::CheckInputSize(new_str.GetSize(), function_name);
+	old_node = yaml_utils::LoadYAML(old_str.GetString());
+	new_node = yaml_utils::LoadYAML(new_str.GetString());
+	// Bound expansion before the recursive walk
+	yaml_utils::CheckExpansionBudget(old_node);
+	yaml_utils::CheckExpansionBudget(new_node);
+}
+
+static LogicalType YAMLDiffEntryType() {
+	auto yaml_type = YAMLTypes::YAMLType();
+	child_list_t<LogicalType> fields;
+	fields.emplace_back("path", LogicalType::VARCHAR);
+	fields.emplace_back("op", LogicalType::VARCHAR);
+	fields.emplace_back("old_value", yaml_type);
+	fields.emplace_back("new_value", yaml_type);
+	return LogicalType::STRUCT(std::move(fields));
+}
+
+static void SetDiffValue(Vector &vector, idx_t index, const YAML::Node &node) {
+	if (!node.IsDefined()) {
+		FlatVector::SetNull(vector, index, true);
+		return;
+	}
+	// const_cast: see comment in YAMLKeysUnaryFunction (yaml_unnest_functions.cpp)
+	auto data = const_cast<string_t *>(FlatVector::GetData<string_t>(vector));
+	data[index] = StringVector::AddString(vector, NodeToFlowYAML(node));
+}
+
+static void YAMLDiffFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(state.GetContext());
+	vector<YAMLDiffEntry> entries;
+	BinaryExecutor::Execute<string_t, string_t, list_entry_t>(
+	    args.data[0], args.data[1], result, args.size(), [&](string_t old_str, string_t new_str) -> list_entry_t {
+		    entries.clear();
+		    try {
+			    YAML::Node old_node, new_node;
+			    LoadDiffInputs(old_str, new_str, "yaml_diff", old_node, new_node);
+			    YAMLDiffWalker walker(&entries);
+			    walker.Diff(old_node, new_node);
+		    } catch (const InterruptException &) {
+			    throw;
+		    } catch (const std::exception &e) {
+			    throw InvalidInputException("Error in yaml_diff: %s", e.what());
+		    }
+
+		    list_entry_t entry;
+		    entry.offset = ListVector::GetListSize(result);
+		    entry.length = entries.size();
+		    ListVector::Reserve(result, entry.offset + entry.length);
+		    auto &child_vector = ListVector::GetEntry(result);
+		    auto &fields = StructVector::GetEntries(child_vector);
+		    auto path_data = const_cast<string_t *>(FlatVector::GetData<string_t>(*fields[0]));
+		    auto op_data = const_cast<string_t *>(FlatVector::GetData<string_t>(*fields[1]));
+		    for (idx_t diff_idx = 0; diff_idx < entries.size(); diff_idx++) {
+			    auto &diff = entries[diff_idx];
+			    auto child_idx = entry.offset + diff_idx;
+			    path_data[child_idx] = StringVector::AddString(*fields[0], diff.path);
+			    op_data[child_idx] = StringVector::AddString(*fields[1], diff.op);
+			    SetDiffValue(*fields[2], child_idx, diff.old_node);
+			    SetDiffValue(*fields[3], child_idx, diff.new_node);
+		    }
+		    ListVector::SetListSize(result, entry.offset + entry.length);
+		    return entry;
+	    });
+	yaml_utils::CheckInterrupted();
+}
+
+static void YAMLDiffersFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(state.GetContext());
+	BinaryExecutor::Execute<string_t, string_t, bool>(
+	    args.data[0], args.data[1], result, args.size(), [&](string_t old_str, string_t new_str) -> bool {
+		    // Identical text cannot differ structurally
+		    if (old_str == new_str) {
+			    return false;
+		    }
+		    try {
+			    YAML::Node old_node, new_node;
+			    LoadDiffInputs(old_str, new_str, "yaml_differs", old_node, new_node);
+			    YAMLDiffWalker walker;
+			    return walker.Diff(old_node, new_node);
+		    } catch (const InterruptException &) {
+			    throw;
+		    } catch (const std::exception &e) {
+			    throw InvalidInputException("Error in yaml_differs: %s", e.what());
+		    }
+	    });
+	yaml_utils::CheckInterrupted();
 }
 
 //===--------------------------------------------------------------------===//
@@ -612,13 +910,14 @@ static YAML::Node YAMLMergePatch(const YAML::Node &target, const YAML::Node &pat
 }
 
 static void YAMLMergePatchFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(state.GetContext());
 	BinaryExecutor::Execute<string_t, string_t, string_t>(
 	    args.data[0], args.data[1], result, args.size(), [&](string_t target_str, string_t patch_str) -> string_t {
 		    try {
 			    yaml_utils::CheckInputSize(target_str.GetSize(), "yaml_merge_patch");
 			    yaml_utils::CheckInputSize(patch_str.GetSize(), "yaml_merge_patch");
-			    YAML::Node target = YAML::Load(target_str.GetString());
-			    YAML::Node patch = YAML::Load(patch_str.GetString());
+			    YAML::Node target = yaml_utils::LoadYAML(target_str.GetString());
+			    YAML::Node patch = yaml_utils::LoadYAML(patch_str.GetString());
 			    // YAMLMergePatch clones/merges the full trees; bound expansion first
 			    // so an alias/anchor bomb is rejected before YAML::Clone runs.
 			    yaml_utils::CheckExpansionBudget(target);
@@ -637,6 +936,7 @@ static void YAMLMergePatchFunction(DataChunk &args, ExpressionState &state, Vect
 			    throw InvalidInputException("Error in yaml_merge_patch: %s", e.what());
 		    }
 	    });
+	yaml_utils::CheckInterrupted();
 }
 
 //===--------------------------------------------------------------------===//
@@ -654,7 +954,7 @@ static void YAMLValueFunction(DataChunk &args, ExpressionState &state, Vector &r
 		    }
 
 		    try {
-			    YAML::Node root = YAML::Load(yaml_str.GetString());
+			    YAML::Node root = yaml_utils::LoadYAML(yaml_str.GetString());
 			    auto path_components = ParseYAMLPath(path_str.GetString());
 			    auto node = ExtractFromYAML(root, path_components);
 
@@ -776,6 +1076,27 @@ void YAMLExtractionFunctions::Register(ExtensionLoader &loader) {
 	    ScalarFunction({LogicalType::VARCHAR, LogicalType::VARCHAR}, yaml_type, YAMLMergePatchFunction));
 	loader.RegisterFunction(yaml_merge_patch_set);
 
+	// yaml_diff function - list of structural differences between two documents
+	auto diff_type = LogicalType::LIST(YAMLDiffEntryType());
+	ScalarFunctionSet yaml_diff_set("yaml_diff");
+	yaml_diff_set.AddFunction(ScalarFunction({yaml_type, yaml_type}, diff_type, YAMLDiffFunction));
+	yaml_diff_set.AddFunction(ScalarFunction({yaml_type, LogicalType::VARCHAR}, diff_type, YAMLDiffFunction));
+	yaml_diff_set.AddFunction(ScalarFunction({LogicalType::VARCHAR, yaml_type}, diff_type, YAMLDiffFunction));
+	yaml_diff_set.AddFunction(
+	    ScalarFunction({LogicalType::VARCHAR, LogicalType::VARCHAR}, diff_type, YAMLDiffFunction));
+	loader.RegisterFunction(yaml_diff_set);
+
+	// yaml_differs function - whether two documents differ, stopping at the first difference
+	ScalarFunctionSet yaml_differs_set("yaml_differs");
+	yaml_differs_set.AddFunction(ScalarFunction({yaml_type, yaml_type}, LogicalType::BOOLEAN, YAMLDiffersFunction));
+	yaml_differs_set.AddFunction(
+	    ScalarFunction({yaml_type, LogicalType::VARCHAR}, LogicalType::BOOLEAN, YAMLDiffersFunction));
+	yaml_differs_set.AddFunction(
+	    ScalarFunction({LogicalType::VARCHAR, yaml_type}, LogicalType::BOOLEAN, YAMLDiffersFunction));
+	yaml_differs_set.AddFunction(
+	    ScalarFunction({LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::BOOLEAN, YAMLDiffersFunction));
+	loader.RegisterFunction(yaml_differs_set);
+
 	// yaml_value function - extract scalar value only, NULL for non-scalars
 	ScalarFunctionSet yaml_value_set("yaml_value");
 	yaml_value_set.AddFunction(
@@ -4,12 +4,22 @@
 #include "yaml_extension.hpp"
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/table_column.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include <unordered_set>
 
 namespace duckdb {
 
+// Column ids of the virtual columns of read_yaml_frontmatter (virtual column ids start at 2^63)
+static constexpr column_t CONTENT_LENGTH_COLUMN_ID = UINT64_C(9223372036854775808) + 16;
+static constexpr column_t CONTENT_HASH_COLUMN_ID = UINT64_C(9223372036854775808) + 17;
+
 // Options for read_yaml_frontmatter
 struct YAMLFrontmatterOptions {
 	bool as_yaml_objects = false;  // If true, expand fields as columns; if false, return single YAML column
@@ -17,31 +27,45 @@ struct YAMLFrontmatterOptions {
 	bool include_filename = false; // If true, include filename column
 };
 
+// A file with frontmatter, located during bind. Only the header is read there; the body is
+// read during the scan, and only when the content column is projected.
+struct YAMLFrontmatterFile {
+	string path;
+	string frontmatter;    // Raw frontmatter YAML
+	idx_t body_offset = 0; // Byte offset of the body (after the closing delimiter line)
+	idx_t file_size = 0;   // File size when the header was read (content_length = file_size - body_offset)
+};
+
 // Bind data for read_yaml_frontmatter
 struct YAMLFrontmatterBindData : public TableFunctionData {
-	vector<string> file_paths;
+	vector<YAMLFrontmatterFile> files;
 	YAMLFrontmatterOptions options;
 	vector<string> names;
 	vector<LogicalType> types;
 };
 
-// Local state for read_yaml_frontmatter
-struct YAMLFrontmatterLocalState : public LocalTableFunctionState {
+// Global state for read_yaml_frontmatter
+struct YAMLFrontmatterGlobalState : public GlobalTableFunctionState {
+	vector<column_t> column_ids; // Projected columns
+	bool needs_header = false;   // Whether any frontmatter column is projected
+	bool needs_body = false;     // Whether the content column or content_hash is projected
 	idx_t current_file = 0;
+	string body_buffer; // Reused body buffer when content_hash is projected without content
 };
 
-// Extract frontmatter from file content
-// Returns a pair of (frontmatter_yaml, body_content)
-// If no frontmatter found, returns empty frontmatter
-static pair<string, string> ExtractFrontmatter(const string &content) {
+// Locate the frontmatter in the (possibly partial) start of a file. Returns false if the
+// frontmatter is not complete within the data; when complete_data is false the caller can
+// retry with more data. On success the frontmatter is [fm_start, fm_end) and the body starts
+// at body_start.
+static bool LocateFrontmatter(const string &content, bool complete_data, idx_t &fm_start, idx_t &fm_end,
+                              idx_t &body_start) {
 	// Frontmatter must start with "---" at the beginning of the file
-	if (content.size() < 3 || content.substr(0, 3) != "---") {
-		return {"", content};
+	if (content.size() < 3 || content.compare(0, 3, "---") != 0) {
+		return false;
 	}
 
-	// Find the end delimiter (--- or ...)
-	size_t start = 3;
 	// Skip whitespace/newline after opening ---
+	size_t start = 3;
 	while (start < content.size() && (content[start] == ' ' || content[start] == '\t')) {
 		start++;
 	}
@@ -51,62 +75,66 @@ static pair<string, string> ExtractFrontmatter(const string &content) {
 		start += 2;
 	}
 
-	// Find closing delimiter
+	// Find closing delimiter: \n--- or \n...
 	size_t end_pos = string::npos;
 	size_t search_pos = start;
-
 	while (search_pos < content.size()) {
-		// Look for \n--- or \n...
 		size_t newline_pos = content.find('\n', search_pos);
 		if (newline_pos == string::npos) {
 			break;
 		}
 
 		size_t line_start = newline_pos + 1;
-		if (line_start + 3 <= content.size()) {
-			string potential_delim = content.substr(line_start, 3);
-			if (potential_delim == "---" || potential_delim == "...") {
-				// Check that it's followed by newline or end of file or whitespace
-				if (line_start + 3 >= content.size() || content[line_start + 3] == '\n' ||
-				    content[line_start + 3] == '\r' || content[line_start + 3] == ' ' ||
-				    content[line_start + 3] == '\t') {
-					end_pos = newline_pos;
-					break;
-				}
+		if (line_start + 3 > content.size() || (line_start + 3 == content.size() && !complete_data)) {
+			// The next line is cut off: more data is needed to tell whether it is a delimiter
+			if (!complete_data) {
+				return false;
+			}
+			break;
+		}
+		if (content.compare(line_start, 3, "---") == 0 || content.compare(line_start, 3, "...") == 0) {
+			// Check that it's followed by newline or end of file or whitespace
+			if (line_start + 3 >= content.size() || content[line_start + 3] == '\n' ||
+			    content[line_start + 3] == '\r' || content[line_start + 3] == ' ' || content[line_start + 3] == '\t') {
+				end_pos = newline_pos;
+				break;
 			}
 		}
 		search_pos = newline_pos + 1;
 	}
 
 	if (end_pos == string::npos) {
-		// No closing delimiter found - treat entire content as body
-		return {"", content};
+		// No closing delimiter found
+		return false;
 	}
 
-	string frontmatter = content.substr(start, end_pos - start);
-
 	// Find start of body (after closing delimiter line)
-	size_t body_start = end_pos + 1; // skip the \n before ---
-	body_start += 3;                 // skip ---
-	// Skip rest of delimiter line
-	while (body_start < content.size() && content[body_start] != '\n' && content[body_start] != '\r') {
-		body_start++;
+	size_t body_pos = end_pos + 1 + 3; // skip the \n before the delimiter and the delimiter
+	while (body_pos < content.size() && content[body_pos] != '\n' && content[body_pos] != '\r') {
+		body_pos++;
 	}
-	// Skip the newline
-	if (body_start < content.size() && content[body_start] == '\r') {
-		body_start++;
+	if (body_pos + 1 >= content.size() && !complete_data) {
+		return false; // The delimiter line (or its line break) is cut off
 	}
-	if (body_start < content.size() && content[body_start] == '\n') {
-		body_start++;
+	if (body_pos < content.size() && content[body_pos] == '\r') {
+		body_pos++;
+	}
+	if (body_pos < content.size() && content[body_pos] == '\n') {
+		body_pos++;
 	}
 
-	string body = body_start < content.size() ? content.substr(body_start) : "";
-
-	return {frontmatter, body};
+	fm_start = start;
+	fm_end = end_pos;
+	body_start = body_pos;
+	return true;
 }
 
-// Read file content
-static string ReadFileContent(ClientContext &context, const string &file_path) {
+// Initial read size when looking for the end of the frontmatter (doubled as needed)
+static constexpr idx_t FRONTMATTER_READ_SIZE = 4096;
+
+// Read the frontmatter of a file, stopping once the closing delimiter is found so the body is
+// never read. Returns false if the file has no frontmatter.
+static bool ReadFrontmatterHeader(ClientContext &context, const string &file_path, YAMLFrontmatterFile &file) {
 	auto &fs = FileSystem::GetFileSystem(context);
 	auto handle = fs.OpenFile(file_path, FileFlags::FILE_FLAGS_READ);
 	auto file_size = handle->GetFileSize();
@@ -116,15 +144,98 @@ static string ReadFileContent(ClientContext &context, const string &file_path) {
 	yaml_utils::CheckInputSize(file_size, "read_yaml_frontmatter");
 
 	string content;
-	content.resize(file_size);
-	handle->Read((void *)content.data(), file_size);
+	idx_t read_size = FRONTMATTER_READ_SIZE;
+	while (content.size() < file_size) {
+		idx_t old_size = content.size();
+		idx_t to_read = MinValue<idx_t>(read_size, file_size - old_size);
+		content.resize(old_size + to_read);
+		handle->Read((void *)(content.data() + old_size), to_read);
+		read_size *= 2;
+
+		if (content.size() >= 3 && content.compare(0, 3, "---") != 0) {
+			return false;
+		}
+		idx_t fm_start, fm_end, body_start;
+		if (LocateFrontmatter(content, content.size() >= file_size, fm_start, fm_end, body_start)) {
+			file.path = file_path;
+			file.frontmatter = content.substr(fm_start, fm_end - fm_start);
+			file.body_offset = body_start;
+			file.file_size = file_size;
+			return !file.frontmatter.empty();
+		}
+	}
+	return false;
+}
+
+static idx_t GetContentLength(const YAMLFrontmatterFile &file) {
+	return file.file_size > file.body_offset ? file.file_size - file.body_offset : 0;
+}
+
+// Read the body of a file (everything after the frontmatter) directly into a string of the
+// result vector, so the body is copied once, from the file into the vector
+static string_t ReadFrontmatterBody(ClientContext &context, const YAMLFrontmatterFile &file, Vector &result) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(file.path, FileFlags::FILE_FLAGS_READ);
+	auto body_size = GetContentLength(file);
+	auto body = StringVector::EmptyString(result, body_size);
+	if (body_size > 0) {
+		handle->Read(body.GetDataWriteable(), body_size, file.body_offset);
+	}
+	body.Finalize();
+	return body;
+}
+
+// Read the body into a reusable buffer (content_hash without the content column)
+static string_t ReadFrontmatterBody(ClientContext &context, const YAMLFrontmatterFile &file, string &buffer) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(file.path, FileFlags::FILE_FLAGS_READ);
+	auto body_size = GetContentLength(file);
+	buffer.resize(body_size);
+	if (body_size > 0) {
+		handle->Read((void *)buffer.data(), body_size, file.body_offset);
+	}
+	return string_t(buffer.data(), UnsafeNumericCast<uint32_t>(body_size));
+}
+
+// Column roles: optional filename first, optional content last, frontmatter columns between
+static bool IsFilenameColumn(const YAMLFrontmatterBindData &bind_data, column_t column_id) {
+	return bind_data.options.include_filename && column_id == 0;
+}
 
-	return content;
+static bool IsContentColumn(const YAMLFrontmatterBindData &bind_data, column_t column_id) {
+	return bind_data.options.include_content && column_id == bind_data.names.size() - 1;
+}
+
+// Parse a file's frontmatter; undefined if it does not parse
+static YAML::Node ParseFrontmatterHeader(const YAMLFrontmatterFile &file) {
+	try {
+		return yaml_utils::LoadYAML(file.frontmatter);
+	} catch (...) {
+		return YAML::Node(YAML::NodeType::Undefined);
+	}
+}
+
+// Value of a frontmatter column; only this column's node is converted
+static Value GetFrontmatterValue(const YAMLFrontmatterBindData &bind_data, const YAMLFrontmatterFile &file,
+                                 const YAML::Node &header, column_t column_id) {
+	auto &type = bind_data.types[column_id];
+	if (bind_data.options.as_yaml_objects) {
+		return Value(file.frontmatter);
+	}
+	if (!header.IsDefined() || !header.IsMap()) {
+		return Value(type); // Non-map or unparseable frontmatter - NULL fields
+	}
+	auto value = header[bind_data.names[column_id]];
+	if (!value.IsDefined()) {
+		return Value(type);
+	}
+	return YAMLReader::YAMLNodeToValue(value, type);
 }
 
 // Bind function for read_yaml_frontmatter
 static unique_ptr<FunctionData> YAMLFrontmatterBind(ClientContext &context, TableFunctionBindInput &input,
                                                     vector<LogicalType> &return_types, vector<string> &names) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(context);
 	auto result = make_uniq<YAMLFrontmatterBindData>();
 
 	// Get file paths from first argument
@@ -132,9 +243,9 @@ static unique_ptr<FunctionData> YAMLFrontmatterBind(ClientContext &context, Tabl
 		throw BinderException("read_yaml_frontmatter requires a file path parameter");
 	}
 
-	result->file_paths = YAMLReader::GetFiles(context, input.inputs[0], false);
+	auto file_paths = YAMLReader::GetFiles(context, input.inputs[0], false);
 
-	if (result->file_paths.empty()) {
+	if (file_paths.empty()) {
 		throw BinderException("No files found matching the provided path");
 	}
 
@@ -150,6 +261,21 @@ static unique_ptr<FunctionData> YAMLFrontmatterBind(ClientContext &context, Tabl
 		}
 	}
 
+	// Locate the frontmatter of every file, reading only up to its closing delimiter.
+	// Files without frontmatter produce no rows and are dropped here.
+	for (const auto &file_path : file_paths) {
+		yaml_utils::CheckInterrupted();
+		YAMLFrontmatterFile file;
+		try {
+			if (ReadFrontmatterHeader(context, file_path, file)) {
+				result->files.push_back(std::move(file));
+			}
+		} catch (...) {
+			// Skip files that can't be read
+			continue;
+		}
+	}
+
 	// Build schema based on options
 	if (result->options.include_filename) {
 		names.push_back("filename");
@@ -162,18 +288,10 @@ static unique_ptr<FunctionData> YAMLFrontmatterBind(ClientContext &context, Tabl
 		vector<string> column_order;
 		unordered_set<string> seen_columns;
 
-		for (const auto &file_path : result->file_paths) {
+		for (const auto &file : result->files) {
 			try {
-				string content = ReadFileContent(context, file_path);
-				auto extracted = ExtractFrontmatter(content);
-				string frontmatter = extracted.first;
-
-				if (frontmatter.empty()) {
-					continue;
-				}
-
 				// Parse the frontmatter YAML
-				YAML::Node node = YAML::Load(frontmatter);
+				YAML::Node node = yaml_utils::LoadYAML(file.frontmatter);
 
 				if (!node.IsMap()) {
 					continue;
@@ -246,114 +364,208 @@ static unique_ptr<FunctionData> YAMLFrontmatterBind(ClientContext &context, Tabl
 	return std::move(result);
 }
 
-// Init local state function
-static unique_ptr<LocalTableFunctionState> YAMLFrontmatterInit(ExecutionContext &context, TableFunctionInitInput &input,
-                                                               GlobalTableFunctionState *global_state) {
-	return make_uniq<YAMLFrontmatterLocalState>();
+// Init global state function
+static unique_ptr<GlobalTableFunctionState> YAMLFrontmatterInit(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<YAMLFrontmatterBindData>();
+	auto result = make_uniq<YAMLFrontmatterGlobalState>();
+	result->column_ids = input.column_ids;
+	for (auto column_id : result->column_ids) {
+		if (column_id == CONTENT_HASH_COLUMN_ID) {
+			result->needs_body = true;
+			continue;
+		}
+		if (column_id >= bind_data.names.size()) {
+			continue; // Row id / content_length / empty projection
+		}
+		if (IsContentColumn(bind_data, column_id)) {
+			result->needs_body = true;
+		} else if (!IsFilenameColumn(bind_data, column_id)) {
+			result->needs_header = true;
+		}
+	}
+	return std::move(result);
 }
 
 // Execution function for read_yaml_frontmatter
 static void YAMLFrontmatterFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = data_p.bind_data->Cast<YAMLFrontmatterBindData>();
-	auto &local_state = data_p.local_state->Cast<YAMLFrontmatterLocalState>();
-
-	if (local_state.current_file >= bind_data.file_paths.size()) {
-		CompatSetOutputCardinality(output, 0);
-		return;
-	}
+	auto &gstate = data_p.global_state->Cast<YAMLFrontmatterGlobalState>();
+	yaml_utils::YAMLInterruptScope interrupt_scope(context);
 
 	output.Reset();
 	idx_t count = 0;
-	idx_t max_count = STANDARD_VECTOR_SIZE;
 
-	while (count < max_count && local_state.current_file < bind_data.file_paths.size()) {
-		const string &file_path = bind_data.file_paths[local_state.current_file];
-		local_state.current_file++;
+	// Output position of the content column, whose strings the bodies are read into
+	optional_idx content_idx;
+	for (idx_t out_idx = 0; out_idx < gstate.column_ids.size(); out_idx++) {
+		auto column_id = gstate.column_ids[out_idx];
+		if (column_id < bind_data.names.size() && IsContentColumn(bind_data, column_id)) {
+			content_idx = out_idx;
+		}
+	}
 
-		try {
-			string content = ReadFileContent(context, file_path);
-			auto extracted = ExtractFrontmatter(content);
-			string frontmatter = extracted.first;
-			string body = extracted.second;
+	while (count < STANDARD_VECTOR_SIZE && gstate.current_file < bind_data.files.size()) {
+		yaml_utils::CheckInterrupted();
+		auto &file = bind_data.files[gstate.current_file++];
 
-			// Skip files with no frontmatter
-			if (frontmatter.empty()) {
+		// Only what is projected is built: the header is parsed for frontmatter columns, and the
+		// body is read for the content and content_hash columns (content_length needs no read)
+		bool parse_header = gstate.needs_header && !bind_data.options.as_yaml_objects;
+		auto header = parse_header ? ParseFrontmatterHeader(file) : YAML::Node(YAML::NodeType::Undefined);
+		string_t body;
+		if (gstate.needs_body) {
+			try {
+				if (content_idx.IsValid()) {
+					body = ReadFrontmatterBody(context, file, output.data[content_idx.GetIndex()]);
+				} else {
+					body = ReadFrontmatterBody(context, file, gstate.body_buffer);
+				}
+			} catch (const std::exception &e) {
+				// Skip files that can't be read
 				continue;
 			}
+		}
 
-			idx_t col_idx = 0;
-
-			// Filename column
-			if (bind_data.options.include_filename) {
-				output.SetValue(col_idx++, count, Value(file_path));
+		for (idx_t out_idx = 0; out_idx < gstate.column_ids.size(); out_idx++) {
+			auto column_id = gstate.column_ids[out_idx];
+			if (column_id == CONTENT_LENGTH_COLUMN_ID) {
+				FlatVector::GetData<int64_t>(output.data[out_idx])[count] =
+				    NumericCast<int64_t>(GetContentLength(file));
+				continue;
 			}
-
-			if (!bind_data.options.as_yaml_objects) {
-				// Default: parse frontmatter and extract fields as columns
-				try {
-					YAML::Node node = YAML::Load(frontmatter);
-
-					if (node.IsMap()) {
-						// Process each column (skip filename if present)
-						idx_t start_col = bind_data.options.include_filename ? 1 : 0;
-						idx_t end_col =
-						    bind_data.options.include_content ? bind_data.names.size() - 1 : bind_data.names.size();
-
-						for (idx_t i = start_col; i < end_col; i++) {
-							const string &col_name = bind_data.names[i];
-							YAML::Node value = node[col_name];
-
-							if (value) {
-								output.SetValue(col_idx, count, YAMLReader::YAMLNodeToValue(value, bind_data.types[i]));
-							} else {
-								output.SetValue(col_idx, count, Value(bind_data.types[i]));
-							}
-							col_idx++;
-						}
-					} else {
-						// Non-map frontmatter - set all fields to NULL
-						idx_t start_col = bind_data.options.include_filename ? 1 : 0;
-						idx_t end_col =
-						    bind_data.options.include_content ? bind_data.names.size() - 1 : bind_data.names.size();
-						for (idx_t i = start_col; i < end_col; i++) {
-							output.SetValue(col_idx++, count, Value(bind_data.types[i]));
-						}
-					}
-				} catch (...) {
-					// Parse error - set all fields to NULL
-					idx_t start_col = bind_data.options.include_filename ? 1 : 0;
-					idx_t end_col =
-					    bind_data.options.include_content ? bind_data.names.size() - 1 : bind_data.names.size();
-					for (idx_t i = start_col; i < end_col; i++) {
-						output.SetValue(col_idx++, count, Value(bind_data.types[i]));
-					}
-				}
+			if (column_id == CONTENT_HASH_COLUMN_ID) {
+				FlatVector::GetData<uint64_t>(output.data[out_idx])[count] = Hash(body);
+				continue;
+			}
+			if (column_id >= bind_data.names.size()) {
+				continue;
+			}
+			if (IsFilenameColumn(bind_data, column_id)) {
+				output.SetValue(out_idx, count, Value(file.path));
+			} else if (IsContentColumn(bind_data, column_id)) {
+				FlatVector::GetData<string_t>(output.data[out_idx])[count] = body;
 			} else {
-				// Return frontmatter as YAML string
-				output.SetValue(col_idx++, count, Value(frontmatter));
+				output.SetValue(out_idx, count, GetFrontmatterValue(bind_data, file, header, column_id));
 			}
+		}
+		count++;
+	}
 
-			// Content column
-			if (bind_data.options.include_content) {
-				output.SetValue(col_idx++, count, Value(body));
-			}
+	CompatSetOutputCardinality(output, count);
+}
 
-			count++;
-		} catch (const std::exception &e) {
-			// Skip files that can't be read
-			continue;
+// Whether an expression only references frontmatter, filename or content_length columns of this scan
+static bool ReferencesOnlyHeaderColumns(const Expression &expr, const LogicalGet &get,
+                                        const YAMLFrontmatterBindData &bind_data, bool &has_reference) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		auto &column_ids = get.GetColumnIds();
+		if (colref.binding.table_index != get.table_index || colref.binding.column_index >= column_ids.size()) {
+			return false;
+		}
+		auto column_id = column_ids[colref.binding.column_index].GetPrimaryIndex();
+		if (column_id == CONTENT_LENGTH_COLUMN_ID) {
+			has_reference = true;
+			return true;
+		}
+		if (column_id >= bind_data.names.size() || IsContentColumn(bind_data, column_id) ||
+		    (bind_data.options.as_yaml_objects && !IsFilenameColumn(bind_data, column_id))) {
+			return false;
 		}
+		has_reference = true;
+		return true;
 	}
+	bool only_header = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		if (!ReferencesOnlyHeaderColumns(child, get, bind_data, has_reference)) {
+			only_header = false;
+		}
+	});
+	return only_header;
+}
 
-	CompatSetOutputCardinality(output, count);
+// Replace column references with the file's values for them (same types as the columns)
+static void BindHeaderValues(unique_ptr<Expression> &expr, const LogicalGet &get,
+                             const YAMLFrontmatterBindData &bind_data, const YAMLFrontmatterFile &file,
+                             const YAML::Node &header) {
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		auto column_id = get.GetColumnIds()[colref.binding.column_index].GetPrimaryIndex();
+		Value value;
+		if (column_id == CONTENT_LENGTH_COLUMN_ID) {
+			value = Value::BIGINT(NumericCast<int64_t>(GetContentLength(file)));
+		} else if (IsFilenameColumn(bind_data, column_id)) {
+			value = Value(file.path);
+		} else {
+			value = GetFrontmatterValue(bind_data, file, header, column_id);
+		}
+		expr = make_uniq<BoundConstantExpression>(value);
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(
+	    *expr, [&](unique_ptr<Expression> &child) { BindHeaderValues(child, get, bind_data, file, header); });
+}
+
+// Drop files whose frontmatter cannot satisfy a filter on frontmatter (or filename, content_length)
+// columns, e.g. WHERE draft = false, before their bodies are read or their rows are built. Each
+// filter is evaluated against the header cached during bind; the filters stay in the plan.
+static void YAMLFrontmatterPushdownFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+                                          vector<unique_ptr<Expression>> &filters) {
+	auto &bind_data = bind_data_p->Cast<YAMLFrontmatterBindData>();
+
+	vector<reference<Expression>> header_filters;
+	for (auto &filter : filters) {
+		bool has_reference = false;
+		if (ReferencesOnlyHeaderColumns(*filter, get, bind_data, has_reference) && has_reference) {
+			header_filters.push_back(*filter);
+		}
+	}
+	if (header_filters.empty()) {
+		return;
+	}
+
+	vector<YAMLFrontmatterFile> remaining_files;
+	for (auto &file : bind_data.files) {
+		auto header = ParseFrontmatterHeader(file);
+		bool keep = true;
+		for (auto &filter : header_filters) {
+			auto file_filter = filter.get().Copy();
+			BindHeaderValues(file_filter, get, bind_data, file, header);
+
+			Value result;
+			if (file_filter->IsFoldable() && ExpressionExecutor::TryEvaluateScalar(context, *file_filter, result) &&
+			    (result.IsNull() || !BooleanValue::Get(result.DefaultCastAs(LogicalType::BOOLEAN)))) {
+				keep = false;
+				break;
+			}
+		}
+		if (keep) {
+			remaining_files.push_back(std::move(file));
+		}
+	}
+	bind_data.files = std::move(remaining_files);
+}
+
+// content_length is known from the file size and the header; content_hash is computed while the
+// body is read, so neither requires the content column to be materialized
+static virtual_column_map_t YAMLFrontmatterVirtualColumns(ClientContext &context,
+                                                          optional_ptr<FunctionData> bind_data) {
+	virtual_column_map_t result;
+	result.insert(make_pair(CONTENT_LENGTH_COLUMN_ID, TableColumn("content_length", LogicalType::BIGINT)));
+	result.insert(make_pair(CONTENT_HASH_COLUMN_ID, TableColumn("content_hash", LogicalType::UBIGINT)));
+	return result;
 }
 
 void RegisterYAMLFrontmatterFunction(ExtensionLoader &loader) {
 	TableFunction read_yaml_frontmatter("read_yaml_frontmatter", {LogicalType::ANY}, YAMLFrontmatterFunction,
 	                                    YAMLFrontmatterBind);
 
-	// Set init function for local state
-	read_yaml_frontmatter.init_local = YAMLFrontmatterInit;
+	// Only projected columns are built; filters on frontmatter columns prune files
+	read_yaml_frontmatter.init_global = YAMLFrontmatterInit;
+	read_yaml_frontmatter.projection_pushdown = true;
+	read_yaml_frontmatter.pushdown_complex_filter = YAMLFrontmatterPushdownFilter;
+	read_yaml_frontmatter.get_virtual_columns = YAMLFrontmatterVirtualColumns;
 
 	// Add named parameters
 	read_yaml_frontmatter.named_parameters["as_yaml_objects"] = LogicalType::BOOLEAN;
@@ -26,7 +26,7 @@ unique_ptr<TableRef> YAMLReader::ReadYAMLReplacement(ClientContext &context, Rep
 	return std::move(table_function);
 }
 
-void YAMLReader::RegisterFunction(ExtensionLoader &loader) {
+TableFunction YAMLReader::GetReadYAMLFunction() {
 	// Create read_yaml table function
 	TableFunction read_yaml("read_yaml", {LogicalType::ANY}, YAMLReadRowsFunction, YAMLReadRowsBind);
 
@@ -39,13 +39,35 @@ void YAMLReader::RegisterFunction(ExtensionLoader &loader) {
 	read_yaml.named_parameters["columns"] = LogicalType::ANY;
 	read_yaml.named_parameters["sample_size"] = LogicalType::BIGINT;
 	read_yaml.named_parameters["maximum_sample_files"] = LogicalType::BIGINT;
-	read_yaml.named_parameters["records"] = LogicalType::VARCHAR;
+	read_yaml.named_parameters["records"] = LogicalType::ANY;
 	read_yaml.named_parameters["frontmatter_as_columns"] = LogicalType::BOOLEAN;
 	read_yaml.named_parameters["list_column_name"] = LogicalType::VARCHAR;
 	read_yaml.named_parameters["strip_document_suffixes"] = LogicalType::BOOLEAN;
+	read_yaml.named_parameters["doc_index"] = LogicalType::ANY; // Accepts BIGINT or BIGINT[]
+	read_yaml.named_parameters["modified_since"] = LogicalType::TIMESTAMP;
+	read_yaml.named_parameters["start_offset"] = LogicalType::BIGINT;
+	read_yaml.named_parameters["schema_file"] = LogicalType::VARCHAR;
+	read_yaml.named_parameters["nested_type"] = LogicalType::VARCHAR;
+	read_yaml.named_parameters["shred_threshold"] = LogicalType::DOUBLE;
+	read_yaml.named_parameters["dedupe"] = LogicalType::VARCHAR;
+	read_yaml.named_parameters["detect_decimal"] = LogicalType::BOOLEAN;
+	read_yaml.named_parameters["dateformat"] = LogicalType::VARCHAR;
+	read_yaml.named_parameters["timestampformat"] = LogicalType::VARCHAR;
+	read_yaml.named_parameters["base64_columns"] = LogicalType::LIST(LogicalType::VARCHAR);
+	read_yaml.named_parameters["schema"] = LogicalType::VARCHAR;
+
+	// Files are read during the scan, so projections and last_modified filters can be pushed down
+	read_yaml.init_global = YAMLReadRowsInit;
+	read_yaml.projection_pushdown = true;
+	read_yaml.pushdown_complex_filter = YAMLReadRowsPushdownFilter;
+	read_yaml.get_virtual_columns = YAMLReadRowsVirtualColumns;
 
-	// Register the function
-	loader.RegisterFunction(read_yaml);
+	return read_yaml;
+}
+
+void YAMLReader::RegisterFunction(ExtensionLoader &loader) {
+	// Register the row-based reader
+	loader.RegisterFunction(GetReadYAMLFunction());
 
 	// Register the object-based reader
 	TableFunction read_yaml_objects("read_yaml_objects", {LogicalType::ANY}, YAMLReadObjectsFunction,
@@ -58,6 +80,7 @@ void YAMLReader::RegisterFunction(ExtensionLoader &loader) {
 	read_yaml_objects.named_parameters["sample_size"] = LogicalType::BIGINT;
 	read_yaml_objects.named_parameters["maximum_sample_files"] = LogicalType::BIGINT;
 	read_yaml_objects.named_parameters["strip_document_suffixes"] = LogicalType::BOOLEAN;
+	read_yaml_objects.named_parameters["doc_index"] = LogicalType::ANY; // Accepts BIGINT or BIGINT[]
 	loader.RegisterFunction(read_yaml_objects);
 
 	// Register parse_yaml table function for parsing YAML strings
@@ -1,7 +1,12 @@
 #include "yaml_reader.hpp"
+#include "yaml_document_index.hpp"
+#include "yaml_archive.hpp"
+#include "yaml_utils.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/enums/file_glob_options.hpp"
+#include <algorithm>
 #include <sstream>
 
 // Detect DuckDB v1.5+ via a header that only exists in v1.5
@@ -121,25 +126,75 @@ vector<string> YAMLReader::GetFiles(ClientContext &context, const Value &path_va
 
 	// Helper lambda to handle individual file paths
 	auto processPath = [&](const string &yaml_path) {
-		// First: check if we're dealing with just a single file that exists
-		if (fs.FileExists(yaml_path)) {
+		// First: check if we're dealing with just a single file that exists (a pattern is never
+		// a file, which saves a metadata call per glob on remote and network file systems)
+		bool has_glob = FileSystem::HasGlob(yaml_path);
+		if (!has_glob && fs.FileExists(yaml_path)) {
 			result.push_back(yaml_path);
 			return;
 		}
 
-		// Second: attempt to use the path as a glob
-		auto glob_files = GetGlobFiles(context, yaml_path);
-		if (glob_files.size() > 0) {
-			result.insert(result.end(), glob_files.begin(), glob_files.end());
-			return;
+		// Second: members of tar archives ("chart.tgz/templates/*.yaml"); each archive stays one
+		// entry so that it is streamed through once
+		string archive_path, member_pattern;
+		if (YAMLArchive::SplitPath(yaml_path, archive_path, member_pattern)) {
+			auto archives = GetGlobFiles(context, archive_path);
+			if (archives.empty() && fs.FileExists(archive_path)) {
+				archives.push_back(archive_path);
+			}
+			if (!archives.empty()) {
+				for (auto &archive : archives) {
+					result.push_back(member_pattern.empty() ? archive : archive + "/" + member_pattern);
+				}
+				return;
+			}
 		}
 
-		// Third: if it looks like a directory, try to glob out all of the yaml children
+		// Third: attempt to use the path as a glob. Alternatives in the file name
+		// ("configs/**/*.{yaml,yml}") are matched during a single listing
+		auto name_start = yaml_path.find_last_of('/') + 1; // 0 without a directory part
+		auto name_pattern = yaml_path.substr(name_start);
+		if (name_pattern.find('{') != string::npos) {
+			auto listing_pattern = yaml_path.substr(0, name_start);
+			for (idx_t pos = 0; pos < name_pattern.size(); pos++) {
+				if (name_pattern[pos] == '{') {
+					auto close = name_pattern.find('}', pos);
+					listing_pattern += '*';
+					pos = close == string::npos ? name_pattern.size() : close;
+				} else {
+					listing_pattern += name_pattern[pos];
+				}
+			}
+			idx_t matched = 0;
+			for (auto &file : GetGlobFiles(context, listing_pattern)) {
+				auto file_name = file.substr(file.find_last_of('/') + 1);
+				if (yaml_utils::MatchPathPattern(file_name, name_pattern)) {
+					result.push_back(file);
+					matched++;
+				}
+			}
+			if (matched > 0) {
+				return;
+			}
+		} else if (has_glob || yaml_path.find("://") != string::npos) {
+			auto glob_files = GetGlobFiles(context, yaml_path);
+			if (glob_files.size() > 0) {
+				result.insert(result.end(), glob_files.begin(), glob_files.end());
+				return;
+			}
+		}
+
+		// Fourth: if it looks like a directory, list it once for both YAML extensions
 		if (StringUtil::EndsWith(yaml_path, "/")) {
-			auto yaml_files = GetGlobFiles(context, fs.JoinPath(yaml_path, "*.yaml"));
-			auto yml_files = GetGlobFiles(context, fs.JoinPath(yaml_path, "*.yml"));
+			auto yaml_files = GetDirectoryYAMLFiles(context, yaml_path);
 			result.insert(result.end(), yaml_files.begin(), yaml_files.end());
-			result.insert(result.end(), yml_files.begin(), yml_files.end());
+			return;
+		}
+
+		// Last: a file whose name only looks like a pattern ("values[prod].yaml") and that
+		// the glob did not match
+		if (has_glob && fs.FileExists(yaml_path)) {
+			result.push_back(yaml_path);
 			return;
 		}
 
@@ -173,6 +228,35 @@ vector<string> YAMLReader::GetFiles(ClientContext &context, const Value &path_va
 	return result;
 }
 
+// The .yaml files and then the .yml files directly inside a directory, from a single listing
+vector<string> YAMLReader::GetDirectoryYAMLFiles(ClientContext &context, const string &directory) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	vector<string> result;
+	try {
+		vector<string> yml_files;
+		fs.ListFiles(directory, [&](const string &name, bool is_directory) {
+			if (is_directory) {
+				return;
+			}
+			if (yaml_utils::MatchPathPattern(name, "*.yaml")) {
+				result.push_back(fs.JoinPath(directory, name));
+			} else if (yaml_utils::MatchPathPattern(name, "*.yml")) {
+				yml_files.push_back(fs.JoinPath(directory, name));
+			}
+		});
+		// Listings are unordered; each extension is sorted like a glob result
+		std::sort(result.begin(), result.end());
+		std::sort(yml_files.begin(), yml_files.end());
+		result.insert(result.end(), yml_files.begin(), yml_files.end());
+	} catch (const NotImplementedException &) {
+		// File systems without directory listing (e.g. object stores) still support globs
+		result = GetGlobFiles(context, fs.JoinPath(directory, "*.yaml"));
+		auto yml_files = GetGlobFiles(context, fs.JoinPath(directory, "*.yml"));
+		result.insert(result.end(), yml_files.begin(), yml_files.end());
+	}
+	return result;
+}
+
 // Helper functions for file globbing and file list handling
 vector<string> YAMLReader::GetGlobFiles(ClientContext &context, const string &pattern) {
 	auto &fs = FileSystem::GetFileSystem(context);
@@ -219,67 +303,248 @@ vector<string> YAMLReader::GetGlobFiles(ClientContext &context, const string &pa
 	return result;
 }
 
-// Helper to read a single file and parse it
-vector<YAML::Node> YAMLReader::ReadYAMLFile(ClientContext &context, const string &file_path,
-                                            const YAMLReadOptions &options) {
-	auto &fs = FileSystem::GetFileSystem(context);
+// Read only the documents selected with doc_index, seeking to each one through the
+// document offset index (a .yidx sidecar if present, otherwise a boundary scan).
+// The size limit applies to the selected bytes rather than to the whole file.
+static vector<YAML::Node> ReadSelectedDocuments(FileSystem &fs, FileHandle &handle, const string &file_path,
+                                                const YAMLReader::YAMLReadOptions &options,
+                                                vector<idx_t> *doc_end_offsets) {
+	auto spans = YAMLDocumentIndex::Load(fs, handle, file_path, false);
+
+	idx_t selected_bytes = 0;
+	for (auto doc_idx : options.document_indexes) {
+		if (doc_idx >= spans.size()) {
+			break;
+		}
+		selected_bytes += spans[doc_idx].byte_length;
+	}
+	if (selected_bytes > options.maximum_object_size) {
+		throw IOException("Selected YAML documents (" + to_string(selected_bytes) +
+		                  " bytes) exceed maximum allowed size (" + to_string(options.maximum_object_size) +
+		                  " bytes)");
+	}
 
-	// Check if file exists
-	if (!fs.FileExists(file_path)) {
-		throw IOException("File does not exist: " + file_path);
+	vector<YAML::Node> docs;
+	for (auto doc_idx : options.document_indexes) {
+		if (doc_idx >= spans.size()) {
+			break;
+		}
+		auto &span = spans[doc_idx];
+		yaml_utils::CheckInterrupted();
+		// Directives declared by an earlier document still apply (see YAMLDocumentSpan)
+		idx_t directives_length = span.InheritsDirectives() ? span.directives_length : 0;
+		string content(directives_length + span.byte_length, ' ');
+		if (directives_length > 0) {
+			handle.Read(const_cast<char *>(content.c_str()), directives_length, span.directives_offset);
+		}
+		handle.Read(const_cast<char *>(content.c_str()) + directives_length, span.byte_length, span.byte_offset);
+		if (options.strip_document_suffixes) {
+			content = YAMLReader::StripDocumentSuffixes(content);
+		}
+		try {
+			docs.push_back(yaml_utils::LoadYAML(content));
+			if (doc_end_offsets) {
+				doc_end_offsets->push_back(span.byte_offset + span.byte_length);
+			}
+		} catch (const YAML::Exception &e) {
+			if (!options.ignore_errors) {
+				throw IOException("Error parsing document " + to_string(doc_idx) + " of YAML file " + file_path +
+				                  ": " + string(e.what()));
+			}
+		}
+		if (options.multi_document_mode == MultiDocumentMode::FIRST) {
+			break;
+		}
 	}
+	return docs;
+}
 
-	auto handle = fs.OpenFile(file_path, FileFlags::FILE_FLAGS_READ);
-	idx_t file_size = fs.GetFileSize(*handle);
+// Tail mode: read the complete documents that start at or after start_offset. A document is
+// complete once a following "---" header or a "..." end marker was written; a trailing
+// document without one may still be growing and is left for the next read. At most
+// maximum_object_size bytes are read, so a large backlog is consumed over several reads.
+static vector<YAML::Node> ReadDocumentsFromOffset(FileSystem &fs, FileHandle &handle, const string &file_path,
+                                                  const YAMLReader::YAMLReadOptions &options,
+                                                  vector<idx_t> *doc_end_offsets) {
+	vector<YAML::Node> docs;
+	idx_t file_size = fs.GetFileSize(handle);
+	if (options.start_offset >= file_size) {
+		return docs;
+	}
 
-	if (file_size > options.maximum_object_size) {
-		throw IOException("YAML file size (" + to_string(file_size) + " bytes) exceeds maximum allowed size (" +
-		                  to_string(options.maximum_object_size) + " bytes)");
+	idx_t read_size = MinValue<idx_t>(file_size - options.start_offset, options.maximum_object_size);
+	string content(read_size, ' ');
+	handle.Read(const_cast<char *>(content.c_str()), read_size, options.start_offset);
+
+	YAMLDocumentScanner scanner;
+	scanner.Feed(content.data(), content.size());
+	scanner.Finish();
+
+	if (read_size == options.maximum_object_size && read_size < file_size - options.start_offset &&
+	    (scanner.spans.empty() || !scanner.spans[0].terminated)) {
+		throw IOException("YAML document at offset " + to_string(options.start_offset) +
+		                  " exceeds maximum allowed size (" + to_string(options.maximum_object_size) + " bytes)");
 	}
 
-	// Read the file content
-	string content(file_size, ' ');
-	fs.Read(*handle, const_cast<char *>(content.c_str()), file_size);
+	for (auto &span : scanner.spans) {
+		if (!span.terminated) {
+			break;
+		}
+		yaml_utils::CheckInterrupted();
+		// Directives declared by an earlier document in the read range still apply; those
+		// before start_offset are not seen
+		string document;
+		if (span.InheritsDirectives()) {
+			document.append(content, span.directives_offset, span.directives_length);
+		}
+		document.append(content, span.byte_offset, span.byte_length);
+		if (options.strip_document_suffixes) {
+			document = YAMLReader::StripDocumentSuffixes(document);
+		}
+		try {
+			docs.push_back(yaml_utils::LoadYAML(document));
+			if (doc_end_offsets) {
+				doc_end_offsets->push_back(options.start_offset + span.byte_offset + span.byte_length);
+			}
+		} catch (const YAML::Exception &e) {
+			if (!options.ignore_errors) {
+				throw IOException("Error parsing document at offset " +
+				                  to_string(options.start_offset + span.byte_offset) + " of YAML file " + file_path +
+				                  ": " + string(e.what()));
+			}
+		}
+		if (options.multi_document_mode == MultiDocumentMode::FIRST) {
+			break;
+		}
+	}
+	return docs;
+}
+
+// Parse the content of one file (or archive member) into documents. With a content cache,
+// byte-identical content reuses the documents parsed for its first occurrence.
+static vector<YAML::Node> ParseYAMLContent(string &content, const YAMLReader::YAMLReadOptions &options,
+                                           YAMLContentCache *content_cache) {
+	string cache_key;
+	idx_t content_size = content.size();
+	if (content_cache) {
+		cache_key = YAMLContentCache::FileKey(content);
+		vector<YAML::Node> cached;
+		if (content_cache->Lookup(cache_key, cached)) {
+			return cached;
+		}
+	}
 
 	// Strip non-standard document suffixes if enabled (issue #34)
 	// This allows parsing files with custom annotations like Unity's "stripped" keyword
 	if (options.strip_document_suffixes) {
-		content = StripDocumentSuffixes(content);
+		content = YAMLReader::StripDocumentSuffixes(content);
 	}
 
 	vector<YAML::Node> docs;
 
 	if (options.multi_document_mode != MultiDocumentMode::FIRST) {
 		try {
-			// First try to parse the entire file at once
-			std::stringstream yaml_stream(content);
-			docs = YAML::LoadAll(yaml_stream);
+			// Parsed one document at a time, so an interrupted query stops between documents
+			auto document_cache = content_cache && content_cache->reuse_documents ? content_cache : nullptr;
+			docs = YAMLReader::LoadDocuments(content, document_cache);
 		} catch (const YAML::Exception &e) {
 			if (!options.ignore_errors) {
 				throw IOException("Error parsing multi-document YAML file: " + string(e.what()));
 			}
 
 			// On error with ignore_errors=true, try to recover partial documents
-			docs = RecoverPartialYAMLDocuments(content);
+			docs = YAMLReader::RecoverPartialYAMLDocuments(content);
 		}
 	} else {
 		// Parse as single-document YAML
 		try {
-			YAML::Node yaml_node = YAML::Load(content);
+			YAML::Node yaml_node = yaml_utils::LoadYAML(content);
 			docs.push_back(yaml_node);
 		} catch (const YAML::Exception &e) {
 			if (!options.ignore_errors) {
 				throw IOException("Error parsing YAML file: " + string(e.what()));
 			}
 			// With ignore_errors=true for single doc, we can try to parse it more leniently
-			auto recovered = RecoverPartialYAMLDocuments(content);
+			auto recovered = YAMLReader::RecoverPartialYAMLDocuments(content);
 			if (!recovered.empty()) {
 				docs = recovered;
 			}
 		}
 	}
 
+	if (content_cache) {
+		content_cache->Store(cache_key, content_size, docs);
+	}
+	return docs;
+}
+
+// Read the members of a tar archive that match the member pattern, parsing each one as it
+// passes. The archive is decompressed sequentially in a single pass and nothing is extracted
+// to disk; maximum_object_size applies to each member.
+static vector<YAML::Node> ReadArchiveMembers(FileSystem &fs, const string &archive_path,
+                                             const string &member_pattern, const YAMLReader::YAMLReadOptions &options,
+                                             YAMLContentCache *content_cache) {
+	if (!options.document_indexes.empty() || options.has_start_offset) {
+		throw IOException("doc_index and start_offset cannot be used with archive members: " + archive_path);
+	}
+	if (!fs.FileExists(archive_path)) {
+		throw IOException("File does not exist: " + archive_path);
+	}
+	vector<YAML::Node> docs;
+	auto parse_member = [&](const string &member_name, string &content) {
+		try {
+			auto member_docs = ParseYAMLContent(content, options, content_cache);
+			docs.insert(docs.end(), member_docs.begin(), member_docs.end());
+		} catch (const IOException &e) {
+			throw IOException("Error in archive member " + archive_path + "/" + member_name + ": " + e.what());
+		}
+	};
+	YAMLArchive::ReadMembers(fs, archive_path, member_pattern, options.maximum_object_size, options.ignore_errors,
+	                         parse_member);
 	return docs;
 }
 
+// Helper to read a single file and parse it
+vector<YAML::Node> YAMLReader::ReadYAMLFile(ClientContext &context, const string &file_path,
+                                            const YAMLReadOptions &options, vector<idx_t> *doc_end_offsets,
+                                            YAMLContentCache *content_cache, Value *content_hash) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(context);
+	yaml_utils::YAMLScalarSizeScope scalar_size_scope(options.maximum_object_size);
+	auto &fs = FileSystem::GetFileSystem(context);
+
+	string archive_path, member_pattern;
+	if (YAMLArchive::ResolvePath(fs, file_path, archive_path, member_pattern)) {
+		return ReadArchiveMembers(fs, archive_path, member_pattern, options, content_cache);
+	}
+
+	// Check if file exists
+	if (!fs.FileExists(file_path)) {
+		throw IOException("File does not exist: " + file_path);
+	}
+
+	auto handle = fs.OpenFile(file_path, FileFlags::FILE_FLAGS_READ);
+	if (!options.document_indexes.empty()) {
+		return ReadSelectedDocuments(fs, *handle, file_path, options, doc_end_offsets);
+	}
+	if (options.has_start_offset) {
+		return ReadDocumentsFromOffset(fs, *handle, file_path, options, doc_end_offsets);
+	}
+	idx_t file_size = fs.GetFileSize(*handle);
+
+	if (file_size > options.maximum_object_size) {
+		throw IOException("YAML file size (" + to_string(file_size) + " bytes) exceeds maximum allowed size (" +
+		                  to_string(options.maximum_object_size) + " bytes)");
+	}
+
+	// Read the file content
+	string content(file_size, ' ');
+	fs.Read(*handle, const_cast<char *>(content.c_str()), file_size);
+
+	// Hashed while the content is at hand, so the content_hash column needs no second read
+	if (content_hash) {
+		*content_hash = Value::UBIGINT(Hash(content.data(), content.size()));
+	}
+	return ParseYAMLContent(content, options, content_cache);
+}
+
 } // namespace duckdb
@@ -1,11 +1,22 @@
 #include "yaml_reader.hpp"
+#include "yaml_archive.hpp"
 #include "duckdb_compat.hpp"
+#include "yaml_utils.hpp"
 #include "yaml_types.hpp"
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/decimal.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "duckdb/common/table_column.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include <algorithm>
+#include <deque>
 #include <unordered_set>
 
 namespace duckdb {
@@ -36,6 +47,92 @@ static MultiDocumentMode ParseMultiDocumentMode(const Value &value) {
 	throw BinderException("multi_document parameter must be a boolean or string");
 }
 
+// Helper function to parse doc_index parameter (integer or list of integers) into sorted document positions
+static vector<idx_t> ParseDocumentIndexes(const Value &value) {
+	vector<idx_t> result;
+	auto add_index = [&](const Value &index_value) {
+		if (index_value.IsNull()) {
+			throw BinderException("doc_index values cannot be NULL");
+		}
+		auto index = index_value.DefaultCastAs(LogicalType::BIGINT).GetValue<int64_t>();
+		if (index < 0) {
+			throw BinderException("doc_index values must be non-negative");
+		}
+		result.push_back(static_cast<idx_t>(index));
+	};
+
+	if (value.type().id() == LogicalTypeId::LIST) {
+		for (auto &child : ListValue::GetChildren(value)) {
+			add_index(child);
+		}
+		if (result.empty()) {
+			throw BinderException("doc_index list cannot be empty");
+		}
+	} else if (value.type().IsIntegral()) {
+		add_index(value);
+	} else {
+		throw BinderException("doc_index parameter must be an integer or a list of integers");
+	}
+
+	std::sort(result.begin(), result.end());
+	result.erase(std::unique(result.begin(), result.end()), result.end());
+	return result;
+}
+
+// Helper function to parse the records parameter (a path or a list of paths)
+static vector<string> ParseRecordsPaths(const Value &value) {
+	vector<string> result;
+	auto add_path = [&](const Value &path_value) {
+		if (path_value.IsNull()) {
+			throw BinderException("read_yaml \"records\" paths cannot be NULL");
+		}
+		auto path = path_value.ToString();
+		if (path.empty()) {
+			throw BinderException("read_yaml \"records\" parameter cannot be an empty string");
+		}
+		if (std::find(result.begin(), result.end(), path) != result.end()) {
+			throw BinderException("read_yaml \"records\" path '" + path + "' is given more than once");
+		}
+		result.push_back(path);
+	};
+
+	if (value.type().id() == LogicalTypeId::LIST) {
+		for (auto &child : ListValue::GetChildren(value)) {
+			add_path(child);
+		}
+		if (result.empty()) {
+			throw BinderException("read_yaml \"records\" list cannot be empty");
+		}
+	} else {
+		add_path(value);
+	}
+	return result;
+}
+
+// Digits left of the decimal point needed to hold any value of a numeric type
+static idx_t DecimalIntegerDigits(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::DECIMAL:
+		return DecimalType::GetWidth(type) - DecimalType::GetScale(type);
+	case LogicalTypeId::TINYINT:
+		return 3;
+	case LogicalTypeId::SMALLINT:
+		return 5;
+	case LogicalTypeId::INTEGER:
+		return 10;
+	case LogicalTypeId::BIGINT:
+		return 19;
+	case LogicalTypeId::UBIGINT:
+		return 20;
+	default:
+		return 39; // HUGEINT: more than a DECIMAL holds
+	}
+}
+
+static idx_t DecimalScale(const LogicalType &type) {
+	return type.id() == LogicalTypeId::DECIMAL ? DecimalType::GetScale(type) : 0;
+}
+
 // Helper function to merge two struct types, preserving fields from both
 // This is crucial for handling nested properties that might exist in some documents but not others
 // For example, if document1 has {user: {profile: {name: "John"}}} and
@@ -48,12 +145,26 @@ static MultiDocumentMode ParseMultiDocumentMode(const Value &value) {
 // Genuinely incompatible types (e.g. number vs string) still fall back to YAML to preserve data.
 // (issue #42: cross-row numeric type degradation)
 LogicalType YAMLReader::WidenConflictingScalarTypes(const LogicalType &a, const LogicalType &b) {
+	if (a == b) {
+		return a;
+	}
 	if (a.IsNumeric() && b.IsNumeric()) {
 		if (a.id() == LogicalTypeId::DOUBLE || b.id() == LogicalTypeId::DOUBLE || a.id() == LogicalTypeId::FLOAT ||
 		    b.id() == LogicalTypeId::FLOAT) {
 			return LogicalType::DOUBLE;
 		}
-		if (a.id() == LogicalTypeId::HUGEINT || b.id() == LogicalTypeId::HUGEINT) {
+		if (a.id() == LogicalTypeId::DECIMAL || b.id() == LogicalTypeId::DECIMAL) {
+			// Enough integer digits for either side and the larger scale
+			auto integer_digits = MaxValue(DecimalIntegerDigits(a), DecimalIntegerDigits(b));
+			auto scale = MaxValue(DecimalScale(a), DecimalScale(b));
+			if (integer_digits + scale > Decimal::MAX_WIDTH_DECIMAL) {
+				return LogicalType::DOUBLE;
+			}
+			return LogicalType::DECIMAL(NumericCast<uint8_t>(integer_digits + scale), NumericCast<uint8_t>(scale));
+		}
+		if (a.id() == LogicalTypeId::HUGEINT || b.id() == LogicalTypeId::HUGEINT ||
+		    a.id() == LogicalTypeId::UBIGINT || b.id() == LogicalTypeId::UBIGINT) {
+			// UBIGINT next to a signed type needs HUGEINT to hold both ranges
 			return LogicalType::HUGEINT;
 		}
 		if (a.id() == LogicalTypeId::BIGINT || b.id() == LogicalTypeId::BIGINT) {
@@ -68,6 +179,13 @@ LogicalType YAMLReader::WidenConflictingScalarTypes(const LogicalType &a, const
 	return YAMLTypes::YAMLType();
 }
 
+bool YAMLReader::TypesNeedWidening(const LogicalType &type1, const LogicalType &type2) {
+	if (type1.id() != type2.id()) {
+		return true;
+	}
+	return type1.id() == LogicalTypeId::DECIMAL && type1 != type2;
+}
+
 LogicalType YAMLReader::MergeStructTypes(const LogicalType &type1, const LogicalType &type2) {
 	if (type1.id() != LogicalTypeId::STRUCT || type2.id() != LogicalTypeId::STRUCT) {
 		// Type conflict (e.g., STRUCT vs scalar) - fall back to YAML to preserve data
@@ -108,12 +226,12 @@ LogicalType YAMLReader::MergeStructTypes(const LogicalType &type1, const Logical
 					auto child2_child = ListType::GetChildType(child2.second);
 					if (merged_child.id() == LogicalTypeId::STRUCT && child2_child.id() == LogicalTypeId::STRUCT) {
 						merged_children[i].second = LogicalType::LIST(MergeStructTypes(merged_child, child2_child));
-					} else if (merged_child.id() != child2_child.id()) {
+					} else if (TypesNeedWidening(merged_child, child2_child)) {
 						// Different list child scalar types - widen instead of collapsing to YAML (issue #42).
 						merged_children[i].second =
 						    LogicalType::LIST(WidenConflictingScalarTypes(merged_child, child2_child));
 					}
-				} else if (merged_children[i].second.id() != child2.second.id()) {
+				} else if (TypesNeedWidening(merged_children[i].second, child2.second)) {
 					// Different scalar types for a field across records - widen (e.g. TINYINT +
 					// SMALLINT -> SMALLINT) instead of collapsing to YAML (issue #42).
 					merged_children[i].second =
@@ -133,6 +251,22 @@ LogicalType YAMLReader::MergeStructTypes(const LogicalType &type1, const Logical
 	return LogicalType::STRUCT(merged_children);
 }
 
+// A file scanned by read_yaml. Files read during bind for schema sampling keep their rows
+// so the scan does not read them a second time.
+struct YAMLScanFile {
+	explicit YAMLScanFile(string path_p) : path(std::move(path_p)) {
+	}
+
+	string path;
+	bool rows_loaded = false;       // Whether rows were read during bind
+	vector<YAML::Node> rows;        // Row nodes of the file (if rows_loaded)
+	vector<idx_t> row_end_offsets;  // End offset of each row's document (if known)
+	vector<idx_t> row_record_paths; // Index into records_paths of each row (several paths only)
+	bool has_last_modified = false; // Whether last_modified was already fetched
+	timestamp_t last_modified;      // Modification time from file metadata
+	Value content_hash;             // Hash of the file content (if rows_loaded and read whole)
+};
+
 // Bind data structure for read_yaml
 struct YAMLReadRowsBindData : public TableFunctionData {
 	YAMLReadRowsBindData(string file_path, YAMLReader::YAMLReadOptions options)
@@ -141,21 +275,168 @@ struct YAMLReadRowsBindData : public TableFunctionData {
 
 	string file_path;
 	YAMLReader::YAMLReadOptions options;
-	vector<YAML::Node> yaml_docs; // Each document in the YAML file (or data rows for FRONTMATTER)
+	vector<YAML::Node> yaml_docs; // Rows for FRONTMATTER mode, documents for LIST mode
 	vector<string> names;         // Column names
 	vector<LogicalType> types;    // Column types
-	idx_t current_doc = 0;        // Current document being processed
+	bool value_column = false;    // Non-map documents: the single column holds the whole document
+
+	// shred_threshold: the "_rest" column holds every key without a typed column
+	bool has_rest_column = false;
+	idx_t rest_column_idx = 0;
+	unordered_set<string> shredded_keys; // Keys with their own typed column
+
+	// Several records paths: the record_path column names each row's path
+	bool has_record_path_column = false;
+	idx_t record_path_column_idx = 0;
+
+	// dedupe: parsed content shared by the bind-time sampling and the scan
+	shared_ptr<YAMLContentCache> content_cache;
+
+	// ROWS and FIRST modes read files lazily during the scan, one file at a time, so files
+	// can be pruned (modified_since, last_modified filters) before they are ever opened
+	bool lazy = false;
+	vector<YAMLScanFile> scan_files;
 
 	// FRONTMATTER mode: metadata from the first document
 	YAML::Node frontmatter;                // First document (metadata) for FRONTMATTER mode
 	vector<string> frontmatter_names;      // Frontmatter column names
 	vector<LogicalType> frontmatter_types; // Frontmatter column types
 	vector<Value> frontmatter_values;      // Frontmatter values (repeated for each row)
+};
 
-	// LIST mode: all documents in a single row
-	bool list_mode_done = false; // Track if we've already returned the single row
+// Global state for read_yaml (mutable execution state)
+struct YAMLReadRowsGlobalState : public GlobalTableFunctionState {
+	vector<column_t> column_ids;        // Projected columns (schema indexes or virtual column ids)
+	vector<ColumnIndex> column_indexes; // Same, with the projected fields of STRUCT columns
+	bool project_last_modified = false; // Whether the last_modified virtual column is projected
+	idx_t file_idx = 0;                 // Next entry of scan_files to read (lazy modes)
+	vector<YAML::Node> rows;            // Rows of the current file (lazy) or all rows (eager)
+	vector<idx_t> row_end_offsets;      // End offset of each row's document (empty if unknown)
+	vector<idx_t> row_record_paths;     // Records path of each row (several paths only)
+	idx_t row_idx = 0;                  // Next row to emit
+	Value last_modified;                // last_modified of the current file
+	Value content_hash;                 // content_hash of the current file
+	bool list_mode_done = false;        // LIST mode: whether the single row was returned
 };
 
+// Column type for a sampled value, honouring auto_detect and nested_type
+static LogicalType DetectColumnType(const YAML::Node &value, const YAMLReader::YAMLReadOptions &options) {
+	if (options.nested_variant && (value.IsMap() || value.IsSequence())) {
+		return YAMLReader::GetVariantType();
+	}
+	if (options.auto_detect_types) {
+		return YAMLReader::DetectYAMLType(value, &options.scalar);
+	}
+	return LogicalType::VARCHAR;
+}
+
+// Modification time from file metadata; the file content is not read
+static timestamp_t GetFileLastModified(FileSystem &fs, const string &path) {
+	// Archive members report the modification time of their archive
+	auto handle = fs.OpenFile(YAMLArchive::StoragePath(fs, path), FileFlags::FILE_FLAGS_READ);
+	return fs.GetLastModifiedTime(*handle);
+}
+
+// Append the record_path column when several records paths are read (after the data columns)
+static void AddRecordPathColumn(YAMLReadRowsBindData &bind_data, vector<string> &names,
+                                vector<LogicalType> &return_types) {
+	if (bind_data.options.records_paths.size() <= 1) {
+		return;
+	}
+	if (std::find(names.begin(), names.end(), YAMLReader::RECORD_PATH_COLUMN_NAME) != names.end()) {
+		throw BinderException("read_yaml \"records\" with several paths adds a \"%s\" column, which conflicts with "
+		                      "a column of the same name",
+		                      YAMLReader::RECORD_PATH_COLUMN_NAME);
+	}
+	bind_data.has_record_path_column = true;
+	bind_data.record_path_column_idx = names.size();
+	names.push_back(YAMLReader::RECORD_PATH_COLUMN_NAME);
+	return_types.push_back(LogicalType::VARCHAR);
+}
+
+// Extract the row nodes of one file's documents for ROWS and FIRST modes. With several
+// records paths, every path is extracted from the same parsed documents and
+// row_record_paths receives the path of each row.
+static vector<YAML::Node> ExtractFileRows(const vector<YAML::Node> &docs, const YAMLReader::YAMLReadOptions &options,
+                                          vector<idx_t> &row_record_paths) {
+	if (options.records_paths.empty()) {
+		// Use the standard extraction logic for ROWS and FIRST modes
+		return YAMLReader::ExtractRowNodes(docs, options.expand_root_sequence);
+	}
+
+	// If records paths are specified, extract records from those paths
+	vector<YAML::Node> file_nodes;
+	for (const auto &doc : docs) {
+		for (idx_t path_idx = 0; path_idx < options.records_paths.size(); path_idx++) {
+			auto &records_path = options.records_paths[path_idx];
+			YAML::Node records_node = YAMLReader::NavigateToPath(doc, records_path);
+			// Check if path was found - check for Undefined type or null node
+			if (records_node.Type() == YAML::NodeType::Undefined || records_node.Type() == YAML::NodeType::Null ||
+			    !records_node.IsDefined()) {
+				if (!options.ignore_errors) {
+					throw BinderException("Records path '" + records_path + "' not found in YAML document");
+				}
+				continue; // Skip this path of the document
+			}
+			if (!records_node.IsSequence()) {
+				if (!options.ignore_errors) {
+					throw BinderException("Records path '" + records_path + "' does not point to a sequence/array");
+				}
+				continue; // Skip this path of the document
+			}
+			// Extract each element from the sequence as a row
+			for (size_t idx = 0; idx < records_node.size(); idx++) {
+				if (records_node[idx].IsMap()) {
+					file_nodes.push_back(records_node[idx]);
+					if (options.records_paths.size() > 1) {
+						row_record_paths.push_back(path_idx);
+					}
+				}
+			}
+		}
+	}
+	return file_nodes;
+}
+
+// Read one file and extract its rows, applying ignore_errors the same way for bind and scan.
+// When documents are read by position, row_end_offsets receives the end offset of each
+// row's document (for the doc_end_offset column); with several records paths,
+// row_record_paths receives the path of each row (for the record_path column).
+// content_hash receives the hash of the file content when the whole file is read.
+static vector<YAML::Node> ReadFileRows(ClientContext &context, const string &file_path,
+                                       const YAMLReader::YAMLReadOptions &options, vector<idx_t> &row_end_offsets,
+                                       vector<idx_t> &row_record_paths, YAMLContentCache *content_cache,
+                                       Value &content_hash) {
+	row_end_offsets.clear();
+	row_record_paths.clear();
+	content_hash = Value(LogicalType::UBIGINT);
+	try {
+		vector<idx_t> doc_end_offsets;
+		auto docs =
+		    YAMLReader::ReadYAMLFile(context, file_path, options, &doc_end_offsets, content_cache, &content_hash);
+		if (doc_end_offsets.empty()) {
+			return ExtractFileRows(docs, options, row_record_paths);
+		}
+		vector<YAML::Node> rows;
+		for (idx_t doc_idx = 0; doc_idx < docs.size(); doc_idx++) {
+			auto doc_rows = ExtractFileRows({docs[doc_idx]}, options, row_record_paths);
+			rows.insert(rows.end(), doc_rows.begin(), doc_rows.end());
+			row_end_offsets.insert(row_end_offsets.end(), doc_rows.size(), doc_end_offsets[doc_idx]);
+		}
+		return rows;
+	} catch (const InterruptException &) {
+		throw;
+	} catch (const std::exception &e) {
+		if (!options.ignore_errors) {
+			throw IOException("Error processing YAML file '" + file_path + "': " + string(e.what()));
+		}
+		// With ignore_errors=true, we allow continuing with other files
+		row_end_offsets.clear();
+		row_record_paths.clear();
+		return vector<YAML::Node>();
+	}
+}
+
 // Bind data structure for read_yaml_objects
 struct YAMLReadBindData : public TableFunctionData {
 	YAMLReadBindData(string file_path, YAMLReader::YAMLReadOptions options)
@@ -170,8 +451,162 @@ struct YAMLReadBindData : public TableFunctionData {
 	idx_t current_row = 0;
 };
 
+//===--------------------------------------------------------------------===//
+// Schema cache
+//===--------------------------------------------------------------------===//
+// With yaml_set_schema_cache(true), read_yaml remembers the schema it detected for a set of
+// arguments. A later bind with the same arguments reuses it without sampling, as long as the
+// file listing is the same and the files read for sampling still have the same size and
+// modification time (sampling is deterministic, so it would detect the same schema).
+
+static constexpr idx_t SCHEMA_CACHE_MAX_ENTRIES = 256;
+
+// Size and modification time of a file, from its metadata
+struct YAMLFileStamp {
+	string path;
+	idx_t size = 0;
+	timestamp_t last_modified;
+
+	bool operator==(const YAMLFileStamp &other) const {
+		return path == other.path && size == other.size && last_modified == other.last_modified;
+	}
+};
+
+struct YAMLSchemaCacheEntry {
+	vector<string> files;          // Files of the scan, in order
+	vector<YAMLFileStamp> sampled; // Files read for schema detection
+	vector<string> names;
+	vector<LogicalType> types;
+	bool value_column = false;
+	bool has_rest_column = false;
+	idx_t rest_column_idx = 0;
+	unordered_set<string> shredded_keys;
+	bool has_record_path_column = false;
+	idx_t record_path_column_idx = 0;
+};
+
+struct YAMLSchemaCache {
+	mutex lock;
+	unordered_map<string, YAMLSchemaCacheEntry> entries;
+	std::deque<string> insertion_order; // Oldest entries are evicted first
+};
+
+static YAMLSchemaCache &GetSchemaCache() {
+	static YAMLSchemaCache cache;
+	return cache;
+}
+
+idx_t YAMLReader::ClearSchemaCache() {
+	auto &cache = GetSchemaCache();
+	lock_guard<mutex> guard(cache.lock);
+	auto dropped = cache.entries.size();
+	cache.entries.clear();
+	cache.insertion_order.clear();
+	return dropped;
+}
+
+static YAMLFileStamp GetFileStamp(FileSystem &fs, const string &path) {
+	YAMLFileStamp stamp;
+	stamp.path = path;
+	auto handle = fs.OpenFile(YAMLArchive::StoragePath(fs, path), FileFlags::FILE_FLAGS_READ);
+	stamp.size = fs.GetFileSize(*handle);
+	stamp.last_modified = fs.GetLastModifiedTime(*handle);
+	return stamp;
+}
+
+// The path argument and every named parameter, in a canonical order
+static string GetSchemaCacheKey(const TableFunctionBindInput &input) {
+	vector<string> parameters;
+	for (auto &entry : input.named_parameters) {
+		parameters.push_back(StringUtil::Lower(entry.first) + "=" + entry.second.ToSQLString());
+	}
+	std::sort(parameters.begin(), parameters.end());
+	return input.inputs[0].ToSQLString() + "\n" + StringUtil::Join(parameters, "\n");
+}
+
+static vector<string> GetScanFilePaths(const YAMLReadRowsBindData &bind_data) {
+	vector<string> paths;
+	for (auto &scan_file : bind_data.scan_files) {
+		paths.push_back(scan_file.path);
+	}
+	return paths;
+}
+
+// Restore a cached schema into the bind data if it is still valid
+static bool LookupCachedSchema(ClientContext &context, const string &key, YAMLReadRowsBindData &bind_data) {
+	YAMLSchemaCacheEntry entry;
+	{
+		auto &cache = GetSchemaCache();
+		lock_guard<mutex> guard(cache.lock);
+		auto it = cache.entries.find(key);
+		if (it == cache.entries.end()) {
+			return false;
+		}
+		entry = it->second;
+	}
+	if (entry.files != GetScanFilePaths(bind_data)) {
+		return false;
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	try {
+		for (auto &stamp : entry.sampled) {
+			if (!(GetFileStamp(fs, stamp.path) == stamp)) {
+				return false;
+			}
+		}
+	} catch (const std::exception &) {
+		return false;
+	}
+
+	bind_data.names = entry.names;
+	bind_data.types = entry.types;
+	bind_data.value_column = entry.value_column;
+	bind_data.has_rest_column = entry.has_rest_column;
+	bind_data.rest_column_idx = entry.rest_column_idx;
+	bind_data.shredded_keys = entry.shredded_keys;
+	bind_data.has_record_path_column = entry.has_record_path_column;
+	bind_data.record_path_column_idx = entry.record_path_column_idx;
+	return true;
+}
+
+static void StoreCachedSchema(ClientContext &context, const string &key, const YAMLReadRowsBindData &bind_data) {
+	YAMLSchemaCacheEntry entry;
+	entry.files = GetScanFilePaths(bind_data);
+	auto &fs = FileSystem::GetFileSystem(context);
+	try {
+		for (auto &scan_file : bind_data.scan_files) {
+			if (scan_file.rows_loaded) {
+				entry.sampled.push_back(GetFileStamp(fs, scan_file.path));
+			}
+		}
+	} catch (const std::exception &) {
+		return; // A sampled file is gone already; nothing worth caching
+	}
+	entry.names = bind_data.names;
+	entry.types = bind_data.types;
+	entry.value_column = bind_data.value_column;
+	entry.has_rest_column = bind_data.has_rest_column;
+	entry.rest_column_idx = bind_data.rest_column_idx;
+	entry.shredded_keys = bind_data.shredded_keys;
+	entry.has_record_path_column = bind_data.has_record_path_column;
+	entry.record_path_column_idx = bind_data.record_path_column_idx;
+
+	auto &cache = GetSchemaCache();
+	lock_guard<mutex> guard(cache.lock);
+	if (cache.entries.find(key) == cache.entries.end()) {
+		if (cache.entries.size() >= SCHEMA_CACHE_MAX_ENTRIES) {
+			cache.entries.erase(cache.insertion_order.front());
+			cache.insertion_order.pop_front();
+		}
+		cache.insertion_order.push_back(key);
+	}
+	cache.entries[key] = std::move(entry);
+}
+
 unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, TableFunctionBindInput &input,
                                                       vector<LogicalType> &return_types, vector<string> &names) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(context);
+
 	// Validate primary input
 	if (input.inputs.empty()) {
 		throw BinderException("read_yaml requires a file path parameter");
@@ -264,19 +699,135 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 		}
 	}
 	if (seen_parameters.find("records") != seen_parameters.end()) {
-		options.records_path = input.named_parameters["records"].GetValue<string>();
-		if (options.records_path.empty()) {
-			throw BinderException("read_yaml \"records\" parameter cannot be an empty string");
-		}
+		options.records_paths = ParseRecordsPaths(input.named_parameters["records"]);
 		// When using records path, we don't expand root sequences (the records path points to the sequence)
 		options.expand_root_sequence = false;
+		if (options.records_paths.size() > 1 && options.multi_document_mode != MultiDocumentMode::ROWS &&
+		    options.multi_document_mode != MultiDocumentMode::FIRST) {
+			throw BinderException("read_yaml \"records\" with several paths is only supported with "
+			                      "multi_document 'rows' or 'first'");
+		}
 	}
 	if (seen_parameters.find("strip_document_suffixes") != seen_parameters.end()) {
 		options.strip_document_suffixes = input.named_parameters["strip_document_suffixes"].GetValue<bool>();
 	}
+	if (seen_parameters.find("doc_index") != seen_parameters.end()) {
+		options.document_indexes = ParseDocumentIndexes(input.named_parameters["doc_index"]);
+	}
+	if (seen_parameters.find("start_offset") != seen_parameters.end()) {
+		auto arg = input.named_parameters["start_offset"].GetValue<int64_t>();
+		if (arg < 0) {
+			throw BinderException("read_yaml \"start_offset\" parameter must be non-negative");
+		}
+		if (!options.document_indexes.empty()) {
+			throw BinderException("read_yaml \"start_offset\" cannot be combined with \"doc_index\"");
+		}
+		options.has_start_offset = true;
+		options.start_offset = static_cast<idx_t>(arg);
+	}
+	if (seen_parameters.find("modified_since") != seen_parameters.end()) {
+		auto &since = input.named_parameters["modified_since"];
+		if (since.IsNull()) {
+			throw BinderException("read_yaml \"modified_since\" parameter cannot be NULL");
+		}
+		options.has_modified_since = true;
+		options.modified_since = since.GetValue<timestamp_t>();
+	}
+	if (seen_parameters.find("nested_type") != seen_parameters.end()) {
+		auto nested_type = StringUtil::Lower(input.named_parameters["nested_type"].GetValue<string>());
+		if (nested_type == "variant") {
+			options.nested_variant = true;
+			GetVariantType(); // Fails early on builds without the VARIANT type
+		} else if (nested_type != "struct") {
+			throw BinderException("read_yaml \"nested_type\" must be 'struct' or 'variant'");
+		}
+	}
+	if (seen_parameters.find("shred_threshold") != seen_parameters.end()) {
+		options.shred_threshold = input.named_parameters["shred_threshold"].GetValue<double>();
+		if (!(options.shred_threshold > 0 && options.shred_threshold <= 1)) {
+			throw BinderException("read_yaml \"shred_threshold\" parameter must be in (0, 1]");
+		}
+		if (options.multi_document_mode == MultiDocumentMode::LIST) {
+			throw BinderException("read_yaml \"shred_threshold\" is not supported with multi_document 'list'");
+		}
+	}
+	if (seen_parameters.find("schema_file") != seen_parameters.end()) {
+		options.schema_file = input.named_parameters["schema_file"].GetValue<string>();
+		if (options.schema_file.empty()) {
+			throw BinderException("read_yaml \"schema_file\" parameter cannot be an empty string");
+		}
+		if (options.multi_document_mode != MultiDocumentMode::ROWS &&
+		    options.multi_document_mode != MultiDocumentMode::FIRST) {
+			throw BinderException("read_yaml \"schema_file\" is only supported with multi_document rows or first");
+		}
+	}
+
+	if (seen_parameters.find("detect_decimal") != seen_parameters.end()) {
+		options.scalar.detect_decimal = input.named_parameters["detect_decimal"].GetValue<bool>();
+	}
+
+	if (seen_parameters.find("schema") != seen_parameters.end()) {
+		auto schema = StringUtil::Lower(input.named_parameters["schema"].GetValue<string>());
+		if (schema == "yaml11") {
+			options.scalar.schema = YAMLResolutionSchema::YAML11;
+		} else if (schema == "core") {
+			options.scalar.schema = YAMLResolutionSchema::CORE;
+		} else if (schema == "json") {
+			options.scalar.schema = YAMLResolutionSchema::JSON;
+		} else {
+			throw BinderException("read_yaml \"schema\" parameter must be 'core', 'json' or 'yaml11'");
+		}
+	}
+
+	if (seen_parameters.find("base64_columns") != seen_parameters.end()) {
+		auto &base64_value = input.named_parameters["base64_columns"];
+		if (base64_value.IsNull()) {
+			throw BinderException("read_yaml \"base64_columns\" parameter cannot be NULL");
+		}
+		for (auto &child : ListValue::GetChildren(base64_value)) {
+			if (child.IsNull()) {
+				throw BinderException("read_yaml \"base64_columns\" cannot contain NULL");
+			}
+			options.base64_columns.push_back(child.GetValue<string>());
+		}
+	}
+
+	// dateformat / timestampformat are compiled once here and used for detection and conversion
+	if (seen_parameters.find("dateformat") != seen_parameters.end()) {
+		auto format = input.named_parameters["dateformat"].GetValue<string>();
+		auto error = StrTimeFormat::ParseFormatSpecifier(format, options.scalar.date_format);
+		if (!error.empty()) {
+			throw BinderException("read_yaml \"dateformat\" parameter is invalid: " + error);
+		}
+		options.scalar.has_date_format = true;
+	}
+	if (seen_parameters.find("timestampformat") != seen_parameters.end()) {
+		auto format = input.named_parameters["timestampformat"].GetValue<string>();
+		auto error = StrTimeFormat::ParseFormatSpecifier(format, options.scalar.timestamp_format);
+		if (!error.empty()) {
+			throw BinderException("read_yaml \"timestampformat\" parameter is invalid: " + error);
+		}
+		options.scalar.has_timestamp_format = true;
+	}
+
+	if (seen_parameters.find("dedupe") != seen_parameters.end()) {
+		auto mode = StringUtil::Lower(input.named_parameters["dedupe"].GetValue<string>());
+		if (mode == "none") {
+			options.dedupe = YAMLDedupMode::NONE;
+		} else if (mode == "files") {
+			options.dedupe = YAMLDedupMode::FILES;
+		} else if (mode == "documents") {
+			options.dedupe = YAMLDedupMode::DOCUMENTS;
+		} else {
+			throw BinderException("read_yaml \"dedupe\" parameter must be 'none', 'files' or 'documents'");
+		}
+	}
 
 	// Create bind data
 	auto result = make_uniq<YAMLReadRowsBindData>(file_path, options);
+	if (options.dedupe != YAMLDedupMode::NONE) {
+		result->content_cache = make_shared_ptr<YAMLContentCache>(options.dedupe == YAMLDedupMode::DOCUMENTS);
+	}
 
 	// Get files using value processing
 	auto files = GetFiles(context, path_value, options.ignore_errors);
@@ -284,6 +835,57 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 		throw IOException("No YAML files found matching the input path");
 	}
 
+	// Prune files not modified since the given time using file metadata only, so unchanged
+	// files are never read
+	auto &fs = FileSystem::GetFileSystem(context);
+	for (const auto &current_file : files) {
+		YAMLScanFile scan_file(current_file);
+		if (options.has_modified_since) {
+			scan_file.last_modified = GetFileLastModified(fs, current_file);
+			scan_file.has_last_modified = true;
+			if (scan_file.last_modified < options.modified_since) {
+				continue;
+			}
+		}
+		result->scan_files.push_back(std::move(scan_file));
+	}
+
+	// ROWS and FIRST modes only read the files needed for schema sampling here; the
+	// rest are read during the scan
+	result->lazy = options.multi_document_mode == MultiDocumentMode::ROWS ||
+	               options.multi_document_mode == MultiDocumentMode::FIRST;
+
+	// A cached schema replaces sampling while the listing and the sampled files are unchanged
+	string schema_cache_key;
+	if (result->lazy && options.schema_file.empty() && !options.has_start_offset &&
+	    yaml_utils::YAMLSettings::GetSchemaCacheEnabled()) {
+		schema_cache_key = GetSchemaCacheKey(input);
+		if (LookupCachedSchema(context, schema_cache_key, *result)) {
+			names = result->names;
+			return_types = result->types;
+			return std::move(result);
+		}
+	}
+
+	// An authoritative schema replaces sampling: no data file is read during bind, and
+	// the columns parameter still overrides individual column types
+	if (!options.schema_file.empty()) {
+		BindSchemaFile(context, options.schema_file, names, return_types);
+		for (idx_t col_idx = 0; col_idx < options.column_names.size(); col_idx++) {
+			auto entry = std::find(names.begin(), names.end(), options.column_names[col_idx]);
+			if (entry != names.end()) {
+				return_types[NumericCast<idx_t>(entry - names.begin())] = options.column_types[col_idx];
+			} else {
+				names.push_back(options.column_names[col_idx]);
+				return_types.push_back(options.column_types[col_idx]);
+			}
+		}
+		AddRecordPathColumn(*result, names, return_types);
+		result->names = names;
+		result->types = return_types;
+		return std::move(result);
+	}
+
 	// Vector to store all the row data items (documents or elements)
 	vector<YAML::Node> row_nodes;
 	// Vector to store all documents (for LIST mode and FRONTMATTER mode)
@@ -292,74 +894,54 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 	vector<YAML::Node> sample_nodes;
 	idx_t sampled_rows = 0;
 	idx_t sampled_files = 0;
-
-	// Read and process all files
-	for (const auto &current_file : files) {
-		try {
-			auto docs = ReadYAMLFile(context, current_file, options);
-
-			// For LIST and FRONTMATTER modes, we need all documents
-			if (options.multi_document_mode == MultiDocumentMode::LIST ||
-			    options.multi_document_mode == MultiDocumentMode::FRONTMATTER) {
-				all_docs.insert(all_docs.end(), docs.begin(), docs.end());
+	// With several records paths, sample_size applies to each path so that every stream
+	// contributes columns to the shared schema
+	vector<idx_t> path_sampled_rows(MaxValue<idx_t>(options.records_paths.size(), 1), 0);
+	auto sample_full = [&]() {
+		for (auto count : path_sampled_rows) {
+			if (count < options.sample_size) {
+				return false;
 			}
+		}
+		return true;
+	};
 
-			vector<YAML::Node> file_nodes;
+	for (auto &scan_file : result->scan_files) {
+		// Keep sampling past the limits until at least one row was found
+		bool sampling = (sampled_files < options.maximum_sample_files && !sample_full()) || sample_nodes.empty();
 
-			// If records path is specified, extract records from that path
-			if (!options.records_path.empty()) {
-				for (const auto &doc : docs) {
-					YAML::Node records_node = NavigateToPath(doc, options.records_path);
-					// Check if path was found - check for Undefined type or null node
-					if (records_node.Type() == YAML::NodeType::Undefined ||
-					    records_node.Type() == YAML::NodeType::Null || !records_node.IsDefined()) {
-						if (!options.ignore_errors) {
-							throw BinderException("Records path '" + options.records_path +
-							                      "' not found in YAML document");
-						}
-						continue; // Skip this document
-					}
-					if (!records_node.IsSequence()) {
-						if (!options.ignore_errors) {
-							throw BinderException("Records path '" + options.records_path +
-							                      "' does not point to a sequence/array");
-						}
-						continue; // Skip this document
-					}
-					// Extract each element from the sequence as a row
-					for (size_t idx = 0; idx < records_node.size(); idx++) {
-						if (records_node[idx].IsMap()) {
-							file_nodes.push_back(records_node[idx]);
-						}
-					}
-				}
-			} else if (options.multi_document_mode == MultiDocumentMode::ROWS ||
-			           options.multi_document_mode == MultiDocumentMode::FIRST) {
-				// Use the standard extraction logic for ROWS and FIRST modes
-				file_nodes = ExtractRowNodes(docs, options.expand_root_sequence);
+		if (result->lazy) {
+			if (!sampling) {
+				break;
 			}
-			// Note: FRONTMATTER and LIST modes handle documents differently (below)
-
-			// Add nodes from this file to the full result set (for ROWS/FIRST modes)
-			if (options.multi_document_mode == MultiDocumentMode::ROWS ||
-			    options.multi_document_mode == MultiDocumentMode::FIRST) {
-				row_nodes.insert(row_nodes.end(), file_nodes.begin(), file_nodes.end());
-
-				// Add nodes to sample set if we haven't reached the sampling limits
-				if (sampled_files < options.maximum_sample_files && sampled_rows < options.sample_size) {
-					for (const auto &node : file_nodes) {
-						if (sampled_rows >= options.sample_size) {
-							break;
-						}
-						sample_nodes.push_back(node);
-						sampled_rows++;
-					}
-					sampled_files++;
+			scan_file.rows = ReadFileRows(context, scan_file.path, options, scan_file.row_end_offsets,
+			                              scan_file.row_record_paths, result->content_cache.get(),
+			                              scan_file.content_hash);
+			scan_file.rows_loaded = true;
+
+			// Add nodes to sample set
+			for (idx_t row_idx = 0; row_idx < scan_file.rows.size(); row_idx++) {
+				auto path_idx = row_idx < scan_file.row_record_paths.size() ? scan_file.row_record_paths[row_idx] : 0;
+				if (path_sampled_rows[path_idx] >= options.sample_size) {
+					continue;
 				}
+				sample_nodes.push_back(scan_file.rows[row_idx]);
+				path_sampled_rows[path_idx]++;
+				sampled_rows++;
 			}
+			sampled_files++;
+			continue;
+		}
+
+		// FRONTMATTER and LIST modes need all documents
+		try {
+			auto docs = ReadYAMLFile(context, scan_file.path, options);
+			all_docs.insert(all_docs.end(), docs.begin(), docs.end());
+		} catch (const InterruptException &) {
+			throw;
 		} catch (const std::exception &e) {
 			if (!options.ignore_errors) {
-				throw IOException("Error processing YAML file '" + current_file + "': " + string(e.what()));
+				throw IOException("Error processing YAML file '" + scan_file.path + "': " + string(e.what()));
 			}
 			// With ignore_errors=true, we allow continuing with other files
 		}
@@ -403,13 +985,14 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 		}
 	}
 
-	// Replace the docs with our processed row_nodes (not used for LIST mode)
+	// Replace the docs with our processed row_nodes (FRONTMATTER mode; not used for LIST mode)
 	result->yaml_docs = row_nodes;
 
 	// Handle LIST mode separately - all documents in a single row
 	if (options.multi_document_mode == MultiDocumentMode::LIST) {
 		// Detect merged schema from all documents
-		LogicalType list_element_type = DetectJaggedYAMLType(sample_nodes);
+		LogicalType list_element_type =
+		    options.nested_variant ? GetVariantType() : DetectJaggedYAMLType(sample_nodes, &options.scalar);
 
 		// Create a LIST type of the detected struct type
 		names.push_back(options.list_column_name);
@@ -429,7 +1012,27 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 	// Handle empty result set early
 	// TODO: This is very messy and could probably be drastically simplified
 	// or at the very least, moved into a helper function
-	if (result->yaml_docs.empty()) {
+	// (in lazy modes sampling only stops early once a row was found, so an empty
+	// sample means every file was read and none had rows)
+	bool no_rows = result->lazy ? sample_nodes.empty() : result->yaml_docs.empty();
+	bool nothing_new = (options.has_modified_since && result->scan_files.empty() && !files.empty()) ||
+	                   options.has_start_offset;
+	if (no_rows && nothing_new) {
+		// Nothing changed since the watermark / no complete document after the offset: an empty
+		// result rather than an error, typed by the columns parameter when given
+		if (!options.column_names.empty()) {
+			names = options.column_names;
+			return_types = options.column_types;
+			AddRecordPathColumn(*result, names, return_types);
+		} else {
+			names.emplace_back("yaml");
+			return_types.emplace_back(LogicalType::VARCHAR);
+		}
+		result->names = names;
+		result->types = return_types;
+		return std::move(result);
+	}
+	if (no_rows) {
 		if (options.ignore_errors) {
 			// With ignore_errors=true, return an empty table with a dummy structure
 			// that matches what would be expected if data existed
@@ -447,7 +1050,7 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 									string key = it->first.Scalar();
 									LogicalType type;
 									if (options.auto_detect_types) {
-										type = DetectYAMLType(it->second);
+										type = DetectYAMLType(it->second, &options.scalar);
 									} else {
 										type = LogicalType::VARCHAR;
 									}
@@ -481,7 +1084,7 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 								string key = it->first.Scalar();
 								LogicalType type;
 								if (options.auto_detect_types) {
-									type = DetectYAMLType(it->second);
+									type = DetectYAMLType(it->second, &options.scalar);
 								} else {
 									type = LogicalType::VARCHAR;
 								}
@@ -525,12 +1128,14 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 	// Uses sample_nodes (limited by sample_size and maximum_sample_files) for schema detection
 	vector<string> column_order;
 	unordered_set<string> seen_columns;
+	unordered_map<string, idx_t> key_counts; // Rows containing each key (for shred_threshold)
 
 	for (auto &node : sample_nodes) {
 		// Process each top-level key in document order
 		for (auto it = node.begin(); it != node.end(); ++it) {
 			std::string key = it->first.Scalar();
 			YAML::Node value = it->second;
+			key_counts[key]++;
 
 			// Track column order from first document
 			if (seen_columns.find(key) == seen_columns.end()) {
@@ -548,20 +1153,16 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 				detected_types[key] = user_type_it->second;
 			} else if (detected_types.find(key) == detected_types.end()) {
 				// Auto-detect type for new columns
-				LogicalType value_type;
-				if (options.auto_detect_types) {
-					value_type = DetectYAMLType(value);
-				} else {
-					value_type = LogicalType::VARCHAR;
-				}
-				detected_types[key] = value_type;
+				detected_types[key] = DetectColumnType(value, options);
 			} else {
 				// Reconcile types for existing auto-detected columns
-				LogicalType value_type;
-				if (options.auto_detect_types) {
-					value_type = DetectYAMLType(value);
-				} else {
-					value_type = LogicalType::VARCHAR;
+				LogicalType value_type = DetectColumnType(value, options);
+
+				if (options.nested_variant &&
+				    (detected_types[key] == GetVariantType() || value_type == GetVariantType())) {
+					// A column that is nested in any row holds VARIANT values; no union is built
+					detected_types[key] = GetVariantType();
+					continue;
 				}
 
 				// Special handling for struct types to merge nested properties
@@ -570,7 +1171,7 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 				if (detected_types[key].id() == LogicalTypeId::STRUCT && value_type.id() == LogicalTypeId::STRUCT) {
 					// Merge the two struct definitions recursively to preserve all fields
 					detected_types[key] = MergeStructTypes(detected_types[key], value_type);
-				} else if (detected_types[key].id() != value_type.id()) {
+				} else if (TypesNeedWidening(detected_types[key], value_type)) {
 					// Different scalar types for a column across records - widen compatible numerics
 					// (e.g. TINYINT + SMALLINT -> SMALLINT, INT + DOUBLE -> DOUBLE) instead of
 					// collapsing to YAML, matching within-node sequence widening (issue #42).
@@ -589,13 +1190,13 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 					string key = "meta_" + it->first.Scalar();
 					LogicalType type;
 					if (options.auto_detect_types) {
-						type = DetectYAMLType(it->second);
+						type = DetectYAMLType(it->second, &options.scalar);
 					} else {
 						type = LogicalType::VARCHAR;
 					}
 					result->frontmatter_names.push_back(key);
 					result->frontmatter_types.push_back(type);
-					result->frontmatter_values.push_back(YAMLNodeToValue(it->second, type));
+					result->frontmatter_values.push_back(YAMLNodeToValue(it->second, type, &options.scalar));
 
 					// Add to output schema (frontmatter columns come first)
 					names.push_back(key);
@@ -612,33 +1213,131 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadRowsBind(ClientContext &context, Ta
 		}
 	}
 
+	// base64_columns are BLOB unless columns gives them another type
+	for (const auto &col : options.base64_columns) {
+		if (detected_types.find(col) != detected_types.end() &&
+		    user_specified_types.find(col) == user_specified_types.end()) {
+			detected_types[col] = LogicalType::BLOB;
+		}
+	}
+
 	// Build the final schema in document order (data columns)
 	for (const auto &col : column_order) {
+		if (options.shred_threshold > 0) {
+			// Rare keys are left to the "_rest" column instead of widening the schema
+			bool frequent = static_cast<double>(key_counts[col]) >=
+			                options.shred_threshold * static_cast<double>(sample_nodes.size());
+			bool user_specified = user_specified_types.find(col) != user_specified_types.end();
+			if (col == REST_COLUMN_NAME || (!frequent && !user_specified)) {
+				continue;
+			}
+			result->shredded_keys.insert(col);
+		}
 		names.push_back(col);
 		return_types.push_back(detected_types[col]);
 	}
+	if (options.shred_threshold > 0 && !sample_nodes.empty() && sample_nodes[0].IsMap()) {
+		result->has_rest_column = true;
+		result->rest_column_idx = names.size();
+		names.push_back(REST_COLUMN_NAME);
+		return_types.push_back(YAMLTypes::YAMLType());
+	}
+	if (!names.empty()) {
+		AddRecordPathColumn(*result, names, return_types);
+	}
 
 	// Special handling for non-map documents
 	if (names.empty() && !sample_nodes.empty()) {
 		// This could happen with non-map documents without expand_root_sequence
 		// Add a fallback value column
 		names.emplace_back("value");
-		if (options.auto_detect_types) {
-			return_types.emplace_back(DetectYAMLType(sample_nodes[0]));
-		} else {
-			return_types.emplace_back(LogicalType::VARCHAR);
-		}
+		result->value_column = true;
+		return_types.emplace_back(DetectColumnType(sample_nodes[0], options));
 	}
 
 	// Save the schema
 	result->names = names;
 	result->types = return_types;
+	if (!schema_cache_key.empty()) {
+		StoreCachedSchema(context, schema_cache_key, *result);
+	}
+
+	return std::move(result);
+}
+
+// Single value of a COPY option; options given without a value (e.g. IGNORE_ERRORS) are true
+static Value GetCopyOptionValue(const string &option, const vector<Value> &values) {
+	if (values.empty()) {
+		return Value::BOOLEAN(true);
+	}
+	if (values.size() != 1) {
+		throw BinderException("COPY (FORMAT YAML) parameter %s expects a single argument.", option);
+	}
+	return values[0];
+}
+
+unique_ptr<FunctionData> YAMLReader::YAMLCopyFromBind(ClientContext &context, CopyFromFunctionBindInput &input,
+                                                      vector<string> &expected_names,
+                                                      vector<LogicalType> &expected_types) {
+	auto &info = input.info;
+	YAMLReadOptions options;
+
+	for (auto &kv : info.options) {
+		auto loption = StringUtil::Lower(kv.first);
+		auto value = GetCopyOptionValue(loption, kv.second);
+		if (loption == "ignore_errors") {
+			options.ignore_errors = BooleanValue::Get(value.DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (loption == "maximum_object_size") {
+			auto arg = value.DefaultCastAs(LogicalType::BIGINT).GetValue<int64_t>();
+			if (arg <= 0) {
+				throw BinderException("maximum_object_size must be a positive integer");
+			}
+			options.maximum_object_size = static_cast<size_t>(arg);
+		} else if (loption == "multi_document") {
+			options.multi_document_mode = ParseMultiDocumentMode(value);
+			if (options.multi_document_mode != MultiDocumentMode::ROWS &&
+			    options.multi_document_mode != MultiDocumentMode::FIRST) {
+				throw BinderException("COPY ... FROM (FORMAT YAML) only supports multi_document true or false");
+			}
+		} else if (loption == "expand_root_sequence") {
+			options.expand_root_sequence = BooleanValue::Get(value.DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (loption == "records") {
+			auto records_path = value.ToString();
+			if (records_path.empty()) {
+				throw BinderException("COPY ... FROM (FORMAT YAML) \"records\" parameter cannot be an empty string");
+			}
+			options.records_paths = {records_path};
+			options.expand_root_sequence = false;
+		} else if (loption == "strip_document_suffixes") {
+			options.strip_document_suffixes = BooleanValue::Get(value.DefaultCastAs(LogicalType::BOOLEAN));
+		} else {
+			throw BinderException("Unknown option for COPY ... FROM ... (FORMAT YAML): \"%s\".", loption);
+		}
+	}
+
+	auto result = make_uniq<YAMLReadRowsBindData>(info.file_path, options);
+
+	auto files = GetFiles(context, Value(info.file_path), options.ignore_errors);
+	if (files.empty() && !options.ignore_errors) {
+		throw IOException("No YAML files found matching the input path");
+	}
+	for (const auto &current_file : files) {
+		result->scan_files.emplace_back(current_file);
+	}
+
+	// The target table is the schema: nothing is read for sampling, and each value is
+	// converted directly to its column type during the scan
+	result->lazy = true;
+	result->names = expected_names;
+	result->types = expected_types;
 
 	return std::move(result);
 }
 
 unique_ptr<FunctionData> YAMLReader::YAMLReadObjectsBind(ClientContext &context, TableFunctionBindInput &input,
                                                          vector<LogicalType> &return_types, vector<string> &names) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(context);
+
 	// Validate primary input
 	if (input.inputs.empty()) {
 		throw BinderException("read_yaml_objects requires a file path parameter");
@@ -725,6 +1424,9 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadObjectsBind(ClientContext &context,
 	if (seen_parameters.find("strip_document_suffixes") != seen_parameters.end()) {
 		options.strip_document_suffixes = input.named_parameters["strip_document_suffixes"].GetValue<bool>();
 	}
+	if (seen_parameters.find("doc_index") != seen_parameters.end()) {
+		options.document_indexes = ParseDocumentIndexes(input.named_parameters["doc_index"]);
+	}
 
 	// Create bind data
 	auto result = make_uniq<YAMLReadBindData>(file_path, options);
@@ -759,6 +1461,8 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadObjectsBind(ClientContext &context,
 				}
 				sampled_files++;
 			}
+		} catch (const InterruptException &) {
+			throw;
 		} catch (const std::exception &e) {
 			if (!options.ignore_errors) {
 				throw IOException("Error processing YAML file '" + file_path + "': " + string(e.what()));
@@ -808,18 +1512,271 @@ unique_ptr<FunctionData> YAMLReader::YAMLReadObjectsBind(ClientContext &context,
 	return std::move(result);
 }
 
+unique_ptr<GlobalTableFunctionState> YAMLReader::YAMLReadRowsInit(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<YAMLReadRowsBindData>();
+	auto result = make_uniq<YAMLReadRowsGlobalState>();
+	result->column_ids = input.column_ids;
+	result->column_indexes = input.column_indexes;
+	for (auto column_id : result->column_ids) {
+		if (column_id == LAST_MODIFIED_COLUMN_ID) {
+			result->project_last_modified = true;
+		}
+	}
+	result->last_modified = Value(LogicalType::TIMESTAMP);
+	result->content_hash = Value(LogicalType::UBIGINT);
+	if (!bind_data.lazy) {
+		// FRONTMATTER rows were already read during bind
+		result->rows = bind_data.yaml_docs;
+	}
+	return std::move(result);
+}
+
+// Advance to the next file with rows (lazy modes). Returns false when all files are done.
+static bool LoadNextFile(ClientContext &context, const YAMLReadRowsBindData &bind_data,
+                         YAMLReadRowsGlobalState &gstate) {
+	while (gstate.file_idx < bind_data.scan_files.size()) {
+		auto &scan_file = bind_data.scan_files[gstate.file_idx++];
+		if (scan_file.rows_loaded) {
+			gstate.rows = scan_file.rows;
+			gstate.row_end_offsets = scan_file.row_end_offsets;
+			gstate.row_record_paths = scan_file.row_record_paths;
+			gstate.content_hash = scan_file.content_hash;
+		} else {
+			gstate.rows = ReadFileRows(context, scan_file.path, bind_data.options, gstate.row_end_offsets,
+			                           gstate.row_record_paths, bind_data.content_cache.get(), gstate.content_hash);
+		}
+		gstate.row_idx = 0;
+		if (gstate.rows.empty()) {
+			continue;
+		}
+		if (gstate.project_last_modified) {
+			auto last_modified = scan_file.has_last_modified
+			                         ? scan_file.last_modified
+			                         : GetFileLastModified(FileSystem::GetFileSystem(context), scan_file.path);
+			gstate.last_modified = Value::TIMESTAMP(last_modified);
+		}
+		return true;
+	}
+	return false;
+}
+
+// The keys of a row without a typed column, as one YAML map (NULL if there are none)
+static Value GetRestValue(const YAMLReadRowsBindData &bind_data, const YAML::Node &node) {
+	if (!node.IsMap()) {
+		return Value(YAMLTypes::YAMLType());
+	}
+	YAML::Node rest(YAML::NodeType::Map);
+	for (auto it = node.begin(); it != node.end(); ++it) {
+		if (bind_data.shredded_keys.find(it->first.Scalar()) == bind_data.shredded_keys.end()) {
+			rest[it->first] = it->second;
+		}
+	}
+	if (rest.size() == 0) {
+		return Value(YAMLTypes::YAMLType());
+	}
+	return YAMLReader::YAMLNodeToValue(rest, YAMLTypes::YAMLType());
+}
+
+// Convert only the projected fields of a STRUCT column (struct field projection pushdown, e.g.
+// SELECT metadata.name); the other fields are left NULL without being converted
+static Value YAMLNodeToProjectedValue(const YAML::Node &node, const LogicalType &type, const ColumnIndex &index,
+                                      const YAMLReader::YAMLScalarOptions *scalar_options) {
+	if (!index.HasChildren() || type.id() != LogicalTypeId::STRUCT || !node || !node.IsMap()) {
+		return YAMLReader::YAMLNodeToValue(node, type, scalar_options);
+	}
+	auto &child_types = StructType::GetChildTypes(type);
+	vector<const ColumnIndex *> projected(child_types.size(), nullptr);
+	for (auto &child_index : index.GetChildIndexes()) {
+		if (child_index.GetPrimaryIndex() < projected.size()) {
+			projected[child_index.GetPrimaryIndex()] = &child_index;
+		}
+	}
+
+	child_list_t<Value> struct_values;
+	for (idx_t child_idx = 0; child_idx < child_types.size(); child_idx++) {
+		auto &entry = child_types[child_idx];
+		if (!projected[child_idx]) {
+			struct_values.push_back(make_pair(entry.first, Value(entry.second))); // Not projected
+			continue;
+		}
+		auto child = node[CompatIdentifierName(entry.first)];
+		if (child.IsDefined()) {
+			struct_values.push_back(make_pair(
+			    entry.first, YAMLNodeToProjectedValue(child, entry.second, *projected[child_idx], scalar_options)));
+		} else {
+			struct_values.push_back(make_pair(entry.first, Value(entry.second))); // NULL value
+		}
+	}
+	return Value::STRUCT(std::move(struct_values));
+}
+
+static bool IsBase64Column(const YAMLReader::YAMLReadOptions &options, const string &name) {
+	return std::find(options.base64_columns.begin(), options.base64_columns.end(), name) !=
+	       options.base64_columns.end();
+}
+
+// Write one row to the output, filling only the projected columns
+static void WriteRow(const YAMLReadRowsBindData &bind_data, const YAMLReadRowsGlobalState &gstate, idx_t row_idx,
+                     DataChunk &output, idx_t row) {
+	YAML::Node node = gstate.rows[row_idx];
+	// For FRONTMATTER mode, frontmatter columns come first (same value for each row)
+	idx_t frontmatter_col_count = bind_data.options.multi_document_mode == MultiDocumentMode::FRONTMATTER
+	                                  ? bind_data.frontmatter_values.size()
+	                                  : 0;
+
+	for (idx_t out_idx = 0; out_idx < gstate.column_ids.size(); out_idx++) {
+		auto column_id = gstate.column_ids[out_idx];
+		if (column_id == YAMLReader::LAST_MODIFIED_COLUMN_ID) {
+			output.SetValue(out_idx, row, gstate.last_modified);
+			continue;
+		}
+		if (column_id == YAMLReader::CONTENT_HASH_COLUMN_ID) {
+			output.SetValue(out_idx, row, gstate.content_hash);
+			continue;
+		}
+		if (column_id == YAMLReader::DOC_END_OFFSET_COLUMN_ID) {
+			if (row_idx < gstate.row_end_offsets.size()) {
+				output.SetValue(out_idx, row, Value::BIGINT(NumericCast<int64_t>(gstate.row_end_offsets[row_idx])));
+			} else {
+				output.SetValue(out_idx, row, Value(LogicalType::BIGINT));
+			}
+			continue;
+		}
+		if (column_id >= bind_data.names.size()) {
+			// Row id / empty projection - nothing to read
+			continue;
+		}
+		if (column_id < frontmatter_col_count) {
+			output.SetValue(out_idx, row, bind_data.frontmatter_values[column_id]);
+			continue;
+		}
+
+		auto &type = bind_data.types[column_id];
+		if (bind_data.has_record_path_column && column_id == bind_data.record_path_column_idx) {
+			output.SetValue(out_idx, row, Value(bind_data.options.records_paths[gstate.row_record_paths[row_idx]]));
+			continue;
+		}
+		if (bind_data.has_rest_column && column_id == bind_data.rest_column_idx) {
+			output.SetValue(out_idx, row, GetRestValue(bind_data, node));
+			continue;
+		}
+		if (bind_data.value_column) {
+			output.SetValue(out_idx, row, YAMLReader::YAMLNodeToValue(node, type, &bind_data.options.scalar));
+			continue;
+		}
+
+		// Get the value for this column from the data node
+		YAML::Node value = node[bind_data.names[column_id]];
+		if (value && value.IsScalar() && type.id() == LogicalTypeId::BLOB &&
+		    (YAMLReader::IsBinaryNode(value) || IsBase64Column(bind_data.options, bind_data.names[column_id]))) {
+			// Decoded straight into the output vector, without an intermediate Value
+			YAMLReader::WriteBase64Blob(value.Scalar(), output.data[out_idx], row);
+			continue;
+		}
+		if (value && out_idx < gstate.column_indexes.size() && gstate.column_indexes[out_idx].HasChildren()) {
+			auto &scalar_options = bind_data.options.scalar;
+			output.SetValue(out_idx, row,
+			                YAMLNodeToProjectedValue(value, type, gstate.column_indexes[out_idx], &scalar_options));
+		} else if (value) {
+			output.SetValue(out_idx, row, YAMLReader::YAMLNodeToValue(value, type, &bind_data.options.scalar));
+		} else {
+			output.SetValue(out_idx, row, Value(type)); // NULL value
+		}
+	}
+}
+
+virtual_column_map_t YAMLReader::YAMLReadRowsVirtualColumns(ClientContext &context,
+                                                            optional_ptr<FunctionData> bind_data) {
+	virtual_column_map_t result;
+	result.insert(make_pair(LAST_MODIFIED_COLUMN_ID, TableColumn("last_modified", LogicalType::TIMESTAMP)));
+	result.insert(make_pair(DOC_END_OFFSET_COLUMN_ID, TableColumn("doc_end_offset", LogicalType::BIGINT)));
+	result.insert(make_pair(CONTENT_HASH_COLUMN_ID, TableColumn("content_hash", LogicalType::UBIGINT)));
+	return result;
+}
+
+// Whether a filter only references the last_modified virtual column of this scan
+static bool ReferencesOnlyLastModified(const Expression &expr, const LogicalGet &get, bool &has_reference) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		auto &column_ids = get.GetColumnIds();
+		if (colref.binding.table_index != get.table_index || colref.binding.column_index >= column_ids.size() ||
+		    column_ids[colref.binding.column_index].GetPrimaryIndex() != YAMLReader::LAST_MODIFIED_COLUMN_ID) {
+			return false;
+		}
+		has_reference = true;
+		return true;
+	}
+	bool only_last_modified = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		if (!ReferencesOnlyLastModified(child, get, has_reference)) {
+			only_last_modified = false;
+		}
+	});
+	return only_last_modified;
+}
+
+static void ReplaceColumnRefs(unique_ptr<Expression> &expr, const Value &value) {
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		expr = make_uniq<BoundConstantExpression>(value);
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(*expr,
+	                                      [&](unique_ptr<Expression> &child) { ReplaceColumnRefs(child, value); });
+}
+
+// Prune files using filters on the last_modified virtual column. Each filter is evaluated
+// against the file's modification time (file metadata only); files for which it cannot be
+// true are dropped before they are read. The filters stay in the plan.
+void YAMLReader::YAMLReadRowsPushdownFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+                                            vector<unique_ptr<Expression>> &filters) {
+	auto &bind_data = bind_data_p->Cast<YAMLReadRowsBindData>();
+	if (!bind_data.lazy) {
+		return;
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+
+	for (auto &filter : filters) {
+		bool has_reference = false;
+		if (!ReferencesOnlyLastModified(*filter, get, has_reference) || !has_reference) {
+			continue;
+		}
+
+		vector<YAMLScanFile> remaining_files;
+		for (auto &scan_file : bind_data.scan_files) {
+			if (!scan_file.has_last_modified) {
+				scan_file.last_modified = GetFileLastModified(fs, scan_file.path);
+				scan_file.has_last_modified = true;
+			}
+			auto file_filter = filter->Copy();
+			ReplaceColumnRefs(file_filter, Value::TIMESTAMP(scan_file.last_modified));
+
+			Value result;
+			if (file_filter->IsFoldable() && ExpressionExecutor::TryEvaluateScalar(context, *file_filter, result) &&
+			    (result.IsNull() || !BooleanValue::Get(result.DefaultCastAs(LogicalType::BOOLEAN)))) {
+				continue;
+			}
+			remaining_files.push_back(std::move(scan_file));
+		}
+		bind_data.scan_files = std::move(remaining_files);
+	}
+}
+
 void YAMLReader::YAMLReadRowsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &bind_data = (YAMLReadRowsBindData &)*data_p.bind_data;
+	auto &bind_data = data_p.bind_data->Cast<YAMLReadRowsBindData>();
+	auto &gstate = data_p.global_state->Cast<YAMLReadRowsGlobalState>();
+	yaml_utils::YAMLInterruptScope interrupt_scope(context);
+
+	// Set up the output chunk
+	output.Reset();
 
 	// Handle LIST mode - return all documents as a single row with STRUCT[] column
 	if (bind_data.options.multi_document_mode == MultiDocumentMode::LIST) {
-		if (bind_data.list_mode_done) {
+		if (gstate.list_mode_done) {
 			CompatSetOutputCardinality(output, 0);
 			return;
 		}
 
-		output.Reset();
-
 		// Convert all documents to a list of values
 		vector<Value> doc_values;
 		LogicalType element_type;
@@ -830,111 +1787,57 @@ void YAMLReader::YAMLReadRowsFunction(ClientContext &context, TableFunctionInput
 		}
 
 		for (const auto &doc : bind_data.yaml_docs) {
-			doc_values.push_back(YAMLNodeToValue(doc, element_type));
+			yaml_utils::CheckInterrupted();
+			doc_values.push_back(YAMLNodeToValue(doc, element_type, &bind_data.options.scalar));
 		}
 
 		// Create the list value
 		Value list_value = Value::LIST(element_type, doc_values);
-		output.SetValue(0, 0, list_value);
+		for (idx_t out_idx = 0; out_idx < gstate.column_ids.size(); out_idx++) {
+			if (gstate.column_ids[out_idx] == 0) {
+				output.SetValue(out_idx, 0, list_value);
+			} else if (gstate.column_ids[out_idx] >= bind_data.names.size()) {
+				// Virtual columns are not tracked across the combined documents
+				output.SetValue(out_idx, 0, Value(output.data[out_idx].GetType()));
+			}
+		}
 
-		bind_data.list_mode_done = true;
+		gstate.list_mode_done = true;
 		CompatSetOutputCardinality(output, 1);
 		return;
 	}
 
-	// If we've processed all rows, we're done
-	if (bind_data.current_doc >= bind_data.yaml_docs.size()) {
-		CompatSetOutputCardinality(output, 0);
-		return;
-	}
-
-	// Process up to STANDARD_VECTOR_SIZE rows at a time
-	idx_t count = 0;
-	idx_t max_count = std::min((idx_t)STANDARD_VECTOR_SIZE, bind_data.yaml_docs.size() - bind_data.current_doc);
-
-	// Set up the output chunk
-	output.Reset();
-
 	// Special case: if we have a dummy column due to ignore_errors=true, just return empty result
 	if (bind_data.names.size() == 1 &&
 	    (bind_data.names[0] == "yaml" && bind_data.types[0].id() == LogicalTypeId::STRUCT &&
 	     StructType::GetChildTypes(bind_data.types[0]).empty())) {
 		// Just return empty result for dummy columns with no data
 		CompatSetOutputCardinality(output, 0);
-		bind_data.current_doc = bind_data.yaml_docs.size(); // Mark as completed
 		return;
 	}
 
-	// Handle value column specially (non-map documents)
-	if (bind_data.names.size() == 1 && bind_data.names[0] == "value") {
-		for (idx_t doc_idx = 0; doc_idx < max_count; doc_idx++) {
-			// Get the current YAML node
-			YAML::Node node = bind_data.yaml_docs[bind_data.current_doc + doc_idx];
-
-			// Convert to DuckDB value
-			Value val = YAMLNodeToValue(node, bind_data.types[0]);
-
-			// Add to output
-			output.SetValue(0, count, val);
-			count++;
-		}
-	} else {
-		// Normal case - process map documents (and FRONTMATTER mode)
-		idx_t frontmatter_col_count = bind_data.frontmatter_values.size();
-
-		for (idx_t doc_idx = 0; doc_idx < max_count; doc_idx++) {
-			// Get the current YAML node
-			YAML::Node node = bind_data.yaml_docs[bind_data.current_doc + doc_idx];
-
-			idx_t col_idx = 0;
-
-			// For FRONTMATTER mode, first add frontmatter columns (same value for each row)
-			if (bind_data.options.multi_document_mode == MultiDocumentMode::FRONTMATTER) {
-				for (idx_t fm_idx = 0; fm_idx < frontmatter_col_count; fm_idx++) {
-					output.SetValue(col_idx, count, bind_data.frontmatter_values[fm_idx]);
-					col_idx++;
-				}
-			}
-
-			// Process data columns
-			for (; col_idx < bind_data.names.size(); col_idx++) {
-				// For FRONTMATTER mode, data column names don't have prefix
-				string col_name;
-				if (bind_data.options.multi_document_mode == MultiDocumentMode::FRONTMATTER) {
-					col_name = bind_data.names[col_idx]; // Already the right name
-				} else {
-					col_name = bind_data.names[col_idx];
-				}
-
-				LogicalType &type = bind_data.types[col_idx];
-
-				// Get the value for this column from the data node
-				YAML::Node value = node[col_name];
-
-				// Convert to DuckDB value
-				Value duckdb_value;
-				if (value) {
-					duckdb_value = YAMLNodeToValue(value, type);
-				} else {
-					duckdb_value = Value(type); // NULL value
-				}
-
-				// Add to output
-				output.SetValue(col_idx, count, duckdb_value);
+	// Process up to STANDARD_VECTOR_SIZE rows at a time, moving on to the next file as needed
+	idx_t count = 0;
+	while (count < STANDARD_VECTOR_SIZE) {
+		if (gstate.row_idx >= gstate.rows.size()) {
+			if (!bind_data.lazy || !LoadNextFile(context, bind_data, gstate)) {
+				break;
 			}
-			count++;
 		}
+		// Conversions may swallow an interrupt raised at one of their checkpoints (a failed
+		// conversion yields NULL), so it is checked again for every row
+		yaml_utils::CheckInterrupted();
+		WriteRow(bind_data, gstate, gstate.row_idx++, output, count);
+		count++;
 	}
 
-	// Update current row
-	bind_data.current_doc += count;
-
 	// Set the cardinality
 	CompatSetOutputCardinality(output, count);
 }
 
 void YAMLReader::YAMLReadObjectsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = (YAMLReadBindData &)*data_p.bind_data;
+	yaml_utils::YAMLInterruptScope interrupt_scope(context);
 
 	// If we've processed all rows, we're done
 	if (bind_data.current_row >= bind_data.yaml_docs.size()) {
@@ -953,6 +1856,7 @@ void YAMLReader::YAMLReadObjectsFunction(ClientContext &context, TableFunctionIn
 	for (idx_t doc_idx = 0; doc_idx < max_count; doc_idx++) {
 		// Get the current YAML node
 		YAML::Node node = bind_data.yaml_docs[bind_data.current_row + doc_idx];
+		yaml_utils::CheckInterrupted();
 
 		// Convert to DuckDB value
 		Value val = YAMLNodeToValue(node, bind_data.types[0]);
@@ -993,6 +1897,8 @@ struct ParseYAMLLocalState : public LocalTableFunctionState {
 
 unique_ptr<FunctionData> YAMLReader::ParseYAMLBind(ClientContext &context, TableFunctionBindInput &input,
                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(context);
+
 	if (input.inputs.empty()) {
 		throw BinderException("parse_yaml requires a YAML string parameter");
 	}
@@ -1027,10 +1933,9 @@ unique_ptr<FunctionData> YAMLReader::ParseYAMLBind(ClientContext &context, Table
 	try {
 		vector<YAML::Node> docs;
 		if (result->multi_document_mode != MultiDocumentMode::FIRST) {
-			std::stringstream ss(yaml_str);
-			docs = YAML::LoadAll(ss);
+			docs = LoadDocuments(yaml_str);
 		} else {
-			docs.push_back(YAML::Load(yaml_str));
+			docs.push_back(yaml_utils::LoadYAML(yaml_str));
 		}
 
 		// Extract row nodes (expand sequences if needed)
@@ -1077,6 +1982,7 @@ unique_ptr<LocalTableFunctionState> YAMLReader::ParseYAMLInit(ExecutionContext &
 void YAMLReader::ParseYAMLFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = data_p.bind_data->Cast<ParseYAMLBindData>();
 	auto &local_state = data_p.local_state->Cast<ParseYAMLLocalState>();
+	yaml_utils::YAMLInterruptScope interrupt_scope(context);
 
 	// If we've processed all rows, we're done
 	if (local_state.current_row >= bind_data.yaml_docs.size()) {
@@ -1092,6 +1998,7 @@ void YAMLReader::ParseYAMLFunction(ClientContext &context, TableFunctionInput &d
 
 	for (idx_t doc_idx = 0; doc_idx < max_count; doc_idx++) {
 		YAML::Node node = bind_data.yaml_docs[local_state.current_row + doc_idx];
+		yaml_utils::CheckInterrupted();
 
 		if (node.IsMap()) {
 			// Map node - process each field as a column
@@ -1,5 +1,9 @@
 #include "yaml_reader.hpp"
+#include "yaml_document_index.hpp"
+#include "yaml_utils.hpp"
+#include "duckdb/common/crypto/md5.hpp"
 #include "duckdb/common/string_util.hpp"
+#include <cstring>
 
 namespace duckdb {
 
@@ -45,11 +49,10 @@ YAML::Node YAMLReader::NavigateToPath(const YAML::Node &node, const string &path
 
 // Helper function for parsing multi-document YAML with error recovery
 vector<YAML::Node> YAMLReader::ParseMultiDocumentYAML(const string &yaml_content, bool ignore_errors) {
-	std::stringstream yaml_stream(yaml_content);
 
 	vector<YAML::Node> valid_docs;
 	try {
-		valid_docs = YAML::LoadAll(yaml_stream);
+		valid_docs = LoadDocuments(yaml_content);
 		return valid_docs;
 	} catch (const YAML::Exception &e) {
 		if (!ignore_errors) {
@@ -61,6 +64,105 @@ vector<YAML::Node> YAMLReader::ParseMultiDocumentYAML(const string &yaml_content
 	}
 }
 
+vector<YAML::Node> YAMLReader::LoadDocuments(const string &yaml_content, YAMLContentCache *content_cache) {
+	if (!content_cache) {
+		// One parser over the whole stream, so directives stay in effect for later documents as
+		// yaml-cpp defines; LoadAllYAML checks for interrupts between documents
+		return yaml_utils::LoadAllYAML(yaml_content);
+	}
+
+	// Split into documents so that repeated ones can be looked up before parsing
+	YAMLDocumentScanner scanner;
+	scanner.Feed(yaml_content.data(), yaml_content.size());
+	scanner.Finish();
+	if (scanner.spans.size() <= 1) {
+		return yaml_utils::LoadAllYAML(yaml_content);
+	}
+
+	vector<YAML::Node> docs;
+	vector<YAML::Node> cached;
+	for (auto &span : scanner.spans) {
+		yaml_utils::CheckInterrupted();
+		auto text = yaml_content.data() + span.byte_offset;
+		auto directives = span.InheritsDirectives() ? yaml_content.data() + span.directives_offset : nullptr;
+		idx_t directives_size = directives ? span.directives_length : 0;
+		// Repeated documents (e.g. identical prefab entries) are parsed once
+		auto key = YAMLContentCache::DocumentKey(directives, directives_size, text, span.byte_length);
+		if (content_cache->Lookup(key, cached)) {
+			docs.push_back(cached[0]);
+			continue;
+		}
+		YAML::Node doc;
+		if (directives) {
+			// Only a document that inherits directives is copied, to parse them in front of it
+			string document(directives, directives_size);
+			document.append(text, span.byte_length);
+			doc.reset(yaml_utils::LoadYAML(document));
+		} else {
+			doc.reset(yaml_utils::LoadYAML(text, span.byte_length));
+		}
+		content_cache->Store(key, directives_size + span.byte_length, {doc});
+		docs.push_back(doc);
+	}
+	return docs;
+}
+
+//===--------------------------------------------------------------------===//
+// Content cache (dedupe)
+//===--------------------------------------------------------------------===//
+
+// A kind tag ('f' for files, 'd' for documents), the MD5 digest and the length of the content
+static string ContentKey(char kind, const char *prefix, idx_t prefix_size, const char *text, idx_t text_size) {
+	MD5Context md5;
+	if (prefix_size > 0) {
+		md5.Add(const_data_ptr_cast(prefix), prefix_size);
+	}
+	md5.Add(const_data_ptr_cast(text), text_size);
+	string key(1 + MD5Context::MD5_HASH_LENGTH_BINARY + sizeof(idx_t), kind);
+	md5.Finish(data_ptr_cast(&key[1]));
+	idx_t size = prefix_size + text_size;
+	memcpy(&key[1 + MD5Context::MD5_HASH_LENGTH_BINARY], &size, sizeof(idx_t));
+	return key;
+}
+
+string YAMLContentCache::FileKey(const string &content) {
+	return ContentKey('f', nullptr, 0, content.data(), content.size());
+}
+
+string YAMLContentCache::DocumentKey(const char *directives, idx_t directives_size, const char *text,
+                                     idx_t text_size) {
+	return ContentKey('d', directives, directives_size, text, text_size);
+}
+
+bool YAMLContentCache::Lookup(const string &key, vector<YAML::Node> &docs) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		return false;
+	}
+	docs = entry->second.docs;
+	return true;
+}
+
+void YAMLContentCache::Store(const string &key, idx_t content_size, vector<YAML::Node> docs) {
+	if (content_size > MAX_CACHED_BYTES) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	if (entries.find(key) != entries.end()) {
+		return; // Parsed concurrently by another thread
+	}
+	while (cached_bytes + content_size > MAX_CACHED_BYTES) {
+		auto oldest = entries.find(insertion_order.front());
+		cached_bytes -= oldest->second.content_size;
+		entries.erase(oldest);
+		insertion_order.pop_front();
+	}
+	entries.emplace(key, Entry {std::move(docs), content_size});
+	insertion_order.push_back(key);
+	cached_bytes += content_size;
+}
+
 // Helper function for extracting row nodes
 vector<YAML::Node> YAMLReader::ExtractRowNodes(const vector<YAML::Node> &docs, bool expand_root_sequence) {
 	vector<YAML::Node> row_nodes;
@@ -139,6 +241,7 @@ vector<YAML::Node> YAMLReader::RecoverPartialYAMLDocuments(const string &yaml_co
 
 	// Try to parse each document individually
 	for (const auto &doc_str : doc_strings) {
+		yaml_utils::CheckInterrupted();
 		try {
 			// Skip empty documents or just whitespace/comments
 			string trimmed = doc_str;
@@ -153,7 +256,7 @@ vector<YAML::Node> YAMLReader::RecoverPartialYAMLDocuments(const string &yaml_co
 				to_parse = "---" + to_parse;
 			}
 
-			YAML::Node doc = YAML::Load(to_parse);
+			YAML::Node doc = yaml_utils::LoadYAML(to_parse);
 			// Check if we got a valid node
 			if (doc.IsDefined() && !doc.IsNull()) {
 				valid_docs.push_back(doc);
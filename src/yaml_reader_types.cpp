@@ -5,20 +5,416 @@
 #include "duckdb/common/types/date.hpp"
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/blob.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/types/decimal.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <cstring>
 #include <limits>
 
 namespace duckdb {
 
+// Standard tag of base64-encoded binary scalars ("!!binary")
+static constexpr const char *BINARY_TAG = "tag:yaml.org,2002:binary";
+
+bool YAMLReader::IsBinaryNode(const YAML::Node &node) {
+	return node.Tag() == BINARY_TAG;
+}
+
+// Base64 text without the line breaks and indentation of block scalars. The input is returned
+// as is when it has none; otherwise the compacted copy is built in buffer.
+static string_t CompactBase64(const string &base64, string &buffer) {
+	if (base64.find_first_of(" \t\r\n") == string::npos) {
+		return string_t(base64);
+	}
+	buffer.reserve(base64.size());
+	for (char c : base64) {
+		if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+			buffer.push_back(c);
+		}
+	}
+	return string_t(buffer);
+}
+
+static bool TryDecodeBase64(const string &base64, string &decoded) {
+	string buffer;
+	auto input = CompactBase64(base64, buffer);
+	try {
+		decoded.resize(Blob::FromBase64Size(input));
+		Blob::FromBase64(input, data_ptr_cast(&decoded[0]), decoded.size());
+		return true;
+	} catch (...) {
+		return false; // Not valid base64
+	}
+}
+
+void YAMLReader::WriteBase64Blob(const string &base64, Vector &result, idx_t row) {
+	string buffer;
+	auto input = CompactBase64(base64, buffer);
+	try {
+		auto size = Blob::FromBase64Size(input);
+		auto blob = StringVector::EmptyString(result, size);
+		Blob::FromBase64(input, data_ptr_cast(blob.GetDataWriteable()), size);
+		blob.Finalize();
+		FlatVector::GetData<string_t>(result)[row] = blob;
+	} catch (...) {
+		FlatVector::SetNull(result, row, true); // Not valid base64
+	}
+}
+
+// UUIDs are only detected in their canonical lowercase 8-4-4-4-12 form, so that the
+// UUID value prints back exactly as written
+static bool IsCanonicalUUID(const std::string &value) {
+	if (value.size() != 36) {
+		return false;
+	}
+	for (idx_t i = 0; i < value.size(); i++) {
+		char c = value[i];
+		if (i == 8 || i == 13 || i == 18 || i == 23) {
+			if (c != '-') {
+				return false;
+			}
+		} else if (!std::isdigit(static_cast<unsigned char>(c)) && !(c >= 'a' && c <= 'f')) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Integer literals outside the BIGINT range: UBIGINT when unsigned and in range, HUGEINT
+// otherwise. Returns INVALID for anything else, including integers that fit in a BIGINT.
+static LogicalType DetectWideIntegerType(const std::string &value) {
+	idx_t start = (value[0] == '-' || value[0] == '+') ? 1 : 0;
+	if (start == value.size()) {
+		return LogicalType::INVALID;
+	}
+	for (idx_t i = start; i < value.size(); i++) {
+		if (!std::isdigit(static_cast<unsigned char>(value[i]))) {
+			return LogicalType::INVALID;
+		}
+	}
+	int64_t bigint_result;
+	if (TryCast::Operation<string_t, int64_t>(string_t(value), bigint_result, true)) {
+		return LogicalType::INVALID;
+	}
+	uint64_t ubigint_result;
+	if (value[0] != '-' && TryCast::Operation<string_t, uint64_t>(string_t(value), ubigint_result, true)) {
+		return LogicalType::UBIGINT;
+	}
+	hugeint_t hugeint_result;
+	if (TryCast::Operation<string_t, hugeint_t>(string_t(value), hugeint_result, true)) {
+		return LogicalType::HUGEINT;
+	}
+	return LogicalType::INVALID; // Beyond HUGEINT: kept as VARCHAR
+}
+
+// Fixed-point literals ("12.50", "-0.125"; no exponent) as the narrowest DECIMAL(p,s) that
+// holds them. Returns INVALID for anything else or beyond 38 digits.
+static LogicalType DetectDecimalType(const std::string &value) {
+	idx_t pos = (value[0] == '-' || value[0] == '+') ? 1 : 0;
+	idx_t integer_digits = 0;
+	idx_t scale = 0;
+	bool has_point = false;
+	for (; pos < value.size(); pos++) {
+		char c = value[pos];
+		if (c == '.') {
+			if (has_point) {
+				return LogicalType::INVALID;
+			}
+			has_point = true;
+		} else if (!std::isdigit(static_cast<unsigned char>(c))) {
+			return LogicalType::INVALID;
+		} else if (has_point) {
+			scale++;
+		} else if (integer_digits > 0 || c != '0') {
+			integer_digits++; // Leading zeros take no width
+		}
+	}
+	if (scale == 0 || integer_digits + scale > Decimal::MAX_WIDTH_DECIMAL) {
+		return LogicalType::INVALID;
+	}
+	return LogicalType::DECIMAL(NumericCast<uint8_t>(integer_digits + scale), NumericCast<uint8_t>(scale));
+}
+
+// Narrowest integer type holding a value
+static LogicalType SmallestIntegerType(int64_t value) {
+	if (value >= -128 && value <= 127) {
+		return LogicalType::TINYINT;
+	} else if (value >= -32768 && value <= 32767) {
+		return LogicalType::SMALLINT;
+	} else if (value >= -2147483648LL && value <= 2147483647LL) {
+		return LogicalType::INTEGER;
+	}
+	return LogicalType::BIGINT;
+}
+
+// Scalars with an explicit standard tag (!!str, !!int, ...) take the tagged type without any
+// detection work. Returns INVALID for other tags and untagged scalars.
+static LogicalType TaggedScalarType(const std::string &tag) {
+	static const std::string STANDARD_TAG_PREFIX = "tag:yaml.org,2002:";
+	if (tag.size() <= STANDARD_TAG_PREFIX.size() ||
+	    tag.compare(0, STANDARD_TAG_PREFIX.size(), STANDARD_TAG_PREFIX) != 0) {
+		return LogicalType::INVALID;
+	}
+	auto name = tag.c_str() + STANDARD_TAG_PREFIX.size();
+	if (strcmp(name, "str") == 0 || strcmp(name, "null") == 0) {
+		return LogicalType::VARCHAR; // !!null: will be NULL in the actual data
+	} else if (strcmp(name, "int") == 0) {
+		return LogicalType::BIGINT;
+	} else if (strcmp(name, "float") == 0) {
+		return LogicalType::DOUBLE;
+	} else if (strcmp(name, "bool") == 0) {
+		return LogicalType::BOOLEAN;
+	} else if (strcmp(name, "timestamp") == 0) {
+		return LogicalType::TIMESTAMP;
+	} else if (strcmp(name, "binary") == 0) {
+		return LogicalType::BLOB;
+	}
+	return LogicalType::INVALID;
+}
+
+// Custom dateformat / timestampformat matches; these take precedence over the built-in
+// formats. Returns INVALID if no custom format matches.
+static LogicalType DetectFormattedTemporalType(const std::string &value,
+                                               const YAMLReader::YAMLScalarOptions *scalar_options) {
+	if (!scalar_options) {
+		return LogicalType::INVALID;
+	}
+	string error_message;
+	date_t date_result;
+	if (scalar_options->has_date_format &&
+	    scalar_options->date_format.TryParseDate(string_t(value), date_result, error_message)) {
+		return LogicalType::DATE;
+	}
+	timestamp_t timestamp_result;
+	if (scalar_options->has_timestamp_format &&
+	    scalar_options->timestamp_format.TryParseTimestamp(string_t(value), timestamp_result, error_message)) {
+		return LogicalType::TIMESTAMP;
+	}
+	return LogicalType::INVALID;
+}
+
+//===--------------------------------------------------------------------===//
+// YAML 1.2 core / JSON schema resolution (schema := 'core' | 'json')
+//===--------------------------------------------------------------------===//
+
+// What a plain scalar resolves to under the core or JSON schema
+enum class CoreScalarKind : uint8_t { STRING, NULL_VALUE, BOOLEAN, INTEGER, HEX_INTEGER, OCTAL_INTEGER, FLOAT };
+
+// Character classes and states of the number matcher
+enum CoreCharClass : uint8_t { CC_ZERO, CC_DIGIT, CC_PLUS, CC_MINUS, CC_DOT, CC_EXP, CC_OTHER, CC_COUNT };
+enum CoreNumberState : uint8_t {
+	NS_START,
+	NS_SIGN,
+	NS_INT,       // Integer digits (accepting: INTEGER)
+	NS_ZERO,      // JSON: an integer part that is a single 0 (accepting: INTEGER)
+	NS_LEAD_DOT,  // Core: "." without integer digits
+	NS_FRAC,      // Integer digits followed by "." and optional digits (accepting: FLOAT)
+	NS_LEAD_FRAC, // Core: ".5" (accepting: FLOAT)
+	NS_EXP,
+	NS_EXP_SIGN,
+	NS_EXP_DIGITS, // (accepting: FLOAT)
+	NS_REJECT,
+	NS_COUNT
+};
+
+struct CoreCharClassTable {
+	CoreCharClassTable() {
+		for (idx_t i = 0; i < 256; i++) {
+			classes[i] = CC_OTHER;
+		}
+		classes[static_cast<uint8_t>('0')] = CC_ZERO;
+		for (char c = '1'; c <= '9'; c++) {
+			classes[static_cast<uint8_t>(c)] = CC_DIGIT;
+		}
+		classes[static_cast<uint8_t>('+')] = CC_PLUS;
+		classes[static_cast<uint8_t>('-')] = CC_MINUS;
+		classes[static_cast<uint8_t>('.')] = CC_DOT;
+		classes[static_cast<uint8_t>('e')] = CC_EXP;
+		classes[static_cast<uint8_t>('E')] = CC_EXP;
+	}
+	uint8_t classes[256];
+};
+static const CoreCharClassTable CORE_CHAR_CLASSES;
+
+#define R NS_REJECT
+// [json][state][class]: the number regexes of the YAML 1.2 core and JSON schemas. Columns are
+// ZERO, DIGIT, PLUS, MINUS, DOT, EXP, OTHER.
+static const uint8_t CORE_NUMBER_TRANSITIONS[2][NS_COUNT][CC_COUNT] = {
+    // Core: [-+]?[0-9]+ and [-+]?(\.[0-9]+|[0-9]+(\.[0-9]*)?)([eE][-+]?[0-9]+)?
+    {
+        {NS_INT, NS_INT, NS_SIGN, NS_SIGN, NS_LEAD_DOT, R, R},           // START
+        {NS_INT, NS_INT, R, R, NS_LEAD_DOT, R, R},                       // SIGN
+        {NS_INT, NS_INT, R, R, NS_FRAC, NS_EXP, R},                      // INT
+        {R, R, R, R, R, R, R},                                           // ZERO (JSON only)
+        {NS_LEAD_FRAC, NS_LEAD_FRAC, R, R, R, R, R},                     // LEAD_DOT
+        {NS_FRAC, NS_FRAC, R, R, R, NS_EXP, R},                          // FRAC
+        {NS_LEAD_FRAC, NS_LEAD_FRAC, R, R, R, NS_EXP, R},                // LEAD_FRAC
+        {NS_EXP_DIGITS, NS_EXP_DIGITS, NS_EXP_SIGN, NS_EXP_SIGN, R, R, R}, // EXP
+        {NS_EXP_DIGITS, NS_EXP_DIGITS, R, R, R, R, R},                   // EXP_SIGN
+        {NS_EXP_DIGITS, NS_EXP_DIGITS, R, R, R, R, R},                   // EXP_DIGITS
+        {R, R, R, R, R, R, R},                                           // REJECT
+    },
+    // JSON: -?(0|[1-9][0-9]*) and -?(0|[1-9][0-9]*)(\.[0-9]*)?([eE][-+]?[0-9]+)?
+    {
+        {NS_ZERO, NS_INT, R, NS_SIGN, R, R, R},                          // START
+        {NS_ZERO, NS_INT, R, R, R, R, R},                                // SIGN
+        {NS_INT, NS_INT, R, R, NS_FRAC, NS_EXP, R},                      // INT
+        {R, R, R, R, NS_FRAC, NS_EXP, R},                                // ZERO
+        {R, R, R, R, R, R, R},                                           // LEAD_DOT (core only)
+        {NS_FRAC, NS_FRAC, R, R, R, NS_EXP, R},                          // FRAC
+        {R, R, R, R, R, R, R},                                           // LEAD_FRAC (core only)
+        {NS_EXP_DIGITS, NS_EXP_DIGITS, NS_EXP_SIGN, NS_EXP_SIGN, R, R, R}, // EXP
+        {NS_EXP_DIGITS, NS_EXP_DIGITS, R, R, R, R, R},                   // EXP_SIGN
+        {NS_EXP_DIGITS, NS_EXP_DIGITS, R, R, R, R, R},                   // EXP_DIGITS
+        {R, R, R, R, R, R, R},                                           // REJECT
+    }};
+#undef R
+
+static bool MatchesAny(const std::string &value, const char *const *literals, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		if (value == literals[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool MatchesRadixDigits(const std::string &value, idx_t start, bool hex) {
+	if (value.size() <= start) {
+		return false;
+	}
+	for (idx_t i = start; i < value.size(); i++) {
+		char c = value[i];
+		bool valid = hex ? std::isxdigit(static_cast<unsigned char>(c)) != 0 : (c >= '0' && c <= '7');
+		if (!valid) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Resolve a plain scalar with the fixed regex set of the YAML 1.2 core (or JSON) schema
+static CoreScalarKind ClassifyCoreScalar(const std::string &value, bool json) {
+	static const char *const CORE_NULLS[] = {"", "~", "null", "Null", "NULL"};
+	static const char *const CORE_BOOLS[] = {"true", "True", "TRUE", "false", "False", "FALSE"};
+	static const char *const CORE_FLOAT_SPECIALS[] = {".inf", ".Inf", ".INF", "+.inf", "+.Inf", "+.INF", "-.inf",
+	                                                  "-.Inf", "-.INF", ".nan", ".NaN", ".NAN"};
+	if (json) {
+		if (value == "null") {
+			return CoreScalarKind::NULL_VALUE;
+		}
+		if (value == "true" || value == "false") {
+			return CoreScalarKind::BOOLEAN;
+		}
+	} else {
+		if (MatchesAny(value, CORE_NULLS, 5)) {
+			return CoreScalarKind::NULL_VALUE;
+		}
+		if (MatchesAny(value, CORE_BOOLS, 6)) {
+			return CoreScalarKind::BOOLEAN;
+		}
+		if (value.size() > 2 && value[0] == '0' && value[1] == 'x') {
+			return MatchesRadixDigits(value, 2, true) ? CoreScalarKind::HEX_INTEGER : CoreScalarKind::STRING;
+		}
+		if (value.size() > 2 && value[0] == '0' && value[1] == 'o') {
+			return MatchesRadixDigits(value, 2, false) ? CoreScalarKind::OCTAL_INTEGER : CoreScalarKind::STRING;
+		}
+		if (MatchesAny(value, CORE_FLOAT_SPECIALS, 12)) {
+			return CoreScalarKind::FLOAT;
+		}
+	}
+
+	// One pass over the characters through the number automaton
+	auto &transitions = CORE_NUMBER_TRANSITIONS[json ? 1 : 0];
+	uint8_t state = NS_START;
+	for (char c : value) {
+		state = transitions[state][CORE_CHAR_CLASSES.classes[static_cast<uint8_t>(c)]];
+		if (state == NS_REJECT) {
+			return CoreScalarKind::STRING;
+		}
+	}
+	switch (state) {
+	case NS_INT:
+	case NS_ZERO:
+		return CoreScalarKind::INTEGER;
+	case NS_FRAC:
+	case NS_LEAD_FRAC:
+	case NS_EXP_DIGITS:
+		return CoreScalarKind::FLOAT;
+	default:
+		return CoreScalarKind::STRING;
+	}
+}
+
+// The value of a 0x / 0o integer; false if it does not fit in a BIGINT
+static bool TryParseRadixInteger(const std::string &value, CoreScalarKind kind, int64_t &result) {
+	uint64_t radix = kind == CoreScalarKind::HEX_INTEGER ? 16 : 8;
+	uint64_t accumulated = 0;
+	for (idx_t i = 2; i < value.size(); i++) {
+		auto c = static_cast<unsigned char>(value[i]);
+		uint64_t digit = std::isdigit(c) ? uint64_t(c - '0') : uint64_t(std::tolower(c) - 'a' + 10);
+		if (accumulated > (static_cast<uint64_t>(NumericLimits<int64_t>::Maximum()) - digit) / radix) {
+			return false;
+		}
+		accumulated = accumulated * radix + digit;
+	}
+	result = static_cast<int64_t>(accumulated);
+	return true;
+}
+
+// Scalar type under schema := 'core' or 'json': only the schema's fixed forms are typed; every
+// other scalar is a string unless a custom dateformat / timestampformat matches
+static LogicalType DetectCoreScalarType(const YAML::Node &node, const YAMLReader::YAMLScalarOptions &scalar_options) {
+	const auto &value = node.Scalar();
+	// Quoted and block scalars carry the non-specific "!" tag and are always strings
+	if (node.Tag() != "!") {
+		auto kind = ClassifyCoreScalar(value, scalar_options.schema == YAMLResolutionSchema::JSON);
+		switch (kind) {
+		case CoreScalarKind::NULL_VALUE:
+			return LogicalType::VARCHAR; // Will be NULL in the actual data
+		case CoreScalarKind::BOOLEAN:
+			return LogicalType::BOOLEAN;
+		case CoreScalarKind::INTEGER: {
+			int64_t int_val;
+			if (TryCast::Operation<string_t, int64_t>(string_t(value), int_val, true)) {
+				return SmallestIntegerType(int_val);
+			}
+			auto wide_integer_type = DetectWideIntegerType(value);
+			return wide_integer_type.id() == LogicalTypeId::INVALID ? LogicalType::VARCHAR : wide_integer_type;
+		}
+		case CoreScalarKind::HEX_INTEGER:
+		case CoreScalarKind::OCTAL_INTEGER: {
+			int64_t int_val;
+			return TryParseRadixInteger(value, kind, int_val) ? SmallestIntegerType(int_val) : LogicalType::VARCHAR;
+		}
+		case CoreScalarKind::FLOAT:
+			if (scalar_options.detect_decimal) {
+				auto decimal_type = DetectDecimalType(value);
+				if (decimal_type.id() != LogicalTypeId::INVALID) {
+					return decimal_type;
+				}
+			}
+			return LogicalType::DOUBLE;
+		case CoreScalarKind::STRING:
+			break;
+		}
+	}
+	auto temporal_type = DetectFormattedTemporalType(value, &scalar_options);
+	return temporal_type.id() == LogicalTypeId::INVALID ? LogicalType::VARCHAR : temporal_type;
+}
+
 // YAML Type Conversions
 // Helper function to detect YAML type.
 // Budget-carrying worker: bounds recursion depth and total node expansion so
 // deeply-nested or alias-bombed input fails with a clean error instead of a
 // stack overflow / exponential blow-up (GHSA-h5hw-g5m6-vmjj).
-static LogicalType DetectYAMLTypeImpl(const YAML::Node &node, yaml_utils::YAMLTraversalBudget &budget) {
+static LogicalType DetectYAMLTypeImpl(const YAML::Node &node, yaml_utils::YAMLTraversalBudget &budget,
+                                      const YAMLReader::YAMLScalarOptions *scalar_options) {
 	if (!node) {
 		return LogicalType::VARCHAR;
 	}
@@ -26,6 +422,13 @@ static LogicalType DetectYAMLTypeImpl(const YAML::Node &node, yaml_utils::YAMLTr
 
 	switch (node.Type()) {
 	case YAML::NodeType::Scalar: {
+		auto tagged_type = TaggedScalarType(node.Tag());
+		if (tagged_type.id() != LogicalTypeId::INVALID) {
+			return tagged_type;
+		}
+		if (scalar_options && scalar_options->schema != YAMLResolutionSchema::YAML11) {
+			return DetectCoreScalarType(node, *scalar_options);
+		}
 		std::string scalar_value = node.Scalar();
 
 		// Check for null values
@@ -43,6 +446,15 @@ static LogicalType DetectYAMLTypeImpl(const YAML::Node &node, yaml_utils::YAMLTr
 			return LogicalType::BOOLEAN;
 		}
 
+		if (IsCanonicalUUID(scalar_value)) {
+			return LogicalType::UUID;
+		}
+
+		auto formatted_type = DetectFormattedTemporalType(scalar_value, scalar_options);
+		if (formatted_type.id() != LogicalTypeId::INVALID) {
+			return formatted_type;
+		}
+
 		// Skip numeric detection for values that might be dates/times
 		bool might_be_temporal = false;
 		if (scalar_value.find('-') != std::string::npos || scalar_value.find(':') != std::string::npos ||
@@ -90,21 +502,24 @@ static LogicalType DetectYAMLTypeImpl(const YAML::Node &node, yaml_utils::YAMLTr
 				return LogicalType::DOUBLE;
 			}
 
+			auto wide_integer_type = DetectWideIntegerType(scalar_value);
+			if (wide_integer_type.id() != LogicalTypeId::INVALID) {
+				return wide_integer_type;
+			}
+			if (scalar_options && scalar_options->detect_decimal) {
+				auto decimal_type = DetectDecimalType(scalar_value);
+				if (decimal_type.id() != LogicalTypeId::INVALID) {
+					return decimal_type;
+				}
+			}
+
 			try {
 				// Try integer
 				size_t pos;
 				int64_t int_val = std::stoll(scalar_value, &pos);
 				if (pos == scalar_value.size()) {
 					// Choose appropriate integer type based on value
-					if (int_val >= -128 && int_val <= 127) {
-						return LogicalType::TINYINT;
-					} else if (int_val >= -32768 && int_val <= 32767) {
-						return LogicalType::SMALLINT;
-					} else if (int_val >= -2147483648LL && int_val <= 2147483647LL) {
-						return LogicalType::INTEGER;
-					} else {
-						return LogicalType::BIGINT;
-					}
+					return SmallestIntegerType(int_val);
 				}
 
 				// Try double
@@ -118,7 +533,8 @@ static LogicalType DetectYAMLTypeImpl(const YAML::Node &node, yaml_utils::YAMLTr
 					if (double_val == std::floor(double_val) && double_val >= std::numeric_limits<int64_t>::min() &&
 					    double_val <= std::numeric_limits<int64_t>::max()) {
 						// It's a whole number, use integer type
-						return DetectYAMLTypeImpl(YAML::Node(std::to_string(static_cast<int64_t>(double_val))), budget);
+						return DetectYAMLTypeImpl(YAML::Node(std::to_string(static_cast<int64_t>(double_val))), budget,
+						                          scalar_options);
 					}
 					return LogicalType::DOUBLE;
 				}
@@ -138,12 +554,12 @@ static LogicalType DetectYAMLTypeImpl(const YAML::Node &node, yaml_utils::YAMLTr
 		bool first_element = true;
 
 		for (size_t idx = 0; idx < node.size(); idx++) {
-			LogicalType element_type = DetectYAMLTypeImpl(node[idx], budget);
+			LogicalType element_type = DetectYAMLTypeImpl(node[idx], budget, scalar_options);
 
 			if (first_element) {
 				common_type = element_type;
 				first_element = false;
-			} else if (common_type.id() == element_type.id()) {
+			} else if (!YAMLReader::TypesNeedWidening(common_type, element_type)) {
 				// If both are structs, merge their fields to handle optional fields
 				if (common_type.id() == LogicalTypeId::STRUCT) {
 					common_type = YAMLReader::MergeStructTypes(common_type, element_type);
@@ -173,20 +589,7 @@ static LogicalType DetectYAMLTypeImpl(const YAML::Node &node, yaml_utils::YAMLTr
 				}
 			} else if (common_type.IsNumeric() && element_type.IsNumeric()) {
 				// Combine numeric types - promote to the wider type
-				// First check if either is DOUBLE
-				if (common_type.id() == LogicalTypeId::DOUBLE || element_type.id() == LogicalTypeId::DOUBLE) {
-					common_type = LogicalType::DOUBLE;
-				}
-				// Then check integer types in order of size
-				else if (common_type.id() == LogicalTypeId::BIGINT || element_type.id() == LogicalTypeId::BIGINT) {
-					common_type = LogicalType::BIGINT;
-				} else if (common_type.id() == LogicalTypeId::INTEGER || element_type.id() == LogicalTypeId::INTEGER) {
-					common_type = LogicalType::INTEGER;
-				} else if (common_type.id() == LogicalTypeId::SMALLINT ||
-				           element_type.id() == LogicalTypeId::SMALLINT) {
-					common_type = LogicalType::SMALLINT;
-				}
-				// If both are TINYINT, keep TINYINT
+				common_type = YAMLReader::WidenConflictingScalarTypes(common_type, element_type);
 			} else {
 				common_type = LogicalType::VARCHAR;
 				break; // No need to check further once we've fallen back to VARCHAR
@@ -199,7 +602,7 @@ static LogicalType DetectYAMLTypeImpl(const YAML::Node &node, yaml_utils::YAMLTr
 		child_list_t<LogicalType> struct_children;
 		for (auto it = node.begin(); it != node.end(); ++it) {
 			std::string key = it->first.Scalar();
-			LogicalType value_type = DetectYAMLTypeImpl(it->second, budget);
+			LogicalType value_type = DetectYAMLTypeImpl(it->second, budget, scalar_options);
 			struct_children.push_back(make_pair(CompatMakeIdentifier(key), value_type));
 		}
 		// Empty maps create STRUCT() with no children, which DuckDB cannot cast
@@ -215,24 +618,33 @@ static LogicalType DetectYAMLTypeImpl(const YAML::Node &node, yaml_utils::YAMLTr
 	}
 }
 
-LogicalType YAMLReader::DetectYAMLType(const YAML::Node &node) {
+LogicalType YAMLReader::GetVariantType() {
+#ifdef DUCKDB_HAS_VARIANT_TYPE
+	return LogicalType::VARIANT();
+#else
+	throw BinderException("read_yaml \"nested_type\" 'variant' requires a DuckDB version with the VARIANT type");
+#endif
+}
+
+LogicalType YAMLReader::DetectYAMLType(const YAML::Node &node, const YAMLScalarOptions *scalar_options) {
 	yaml_utils::YAMLTraversalBudget budget;
-	return DetectYAMLTypeImpl(node, budget);
+	return DetectYAMLTypeImpl(node, budget, scalar_options);
 }
 
 // Helper function to detect YAML type across multiple documents with jagged schema support
 // Uses MergeStructTypes to recursively merge nested struct fields from all documents
-LogicalType YAMLReader::DetectJaggedYAMLType(const vector<YAML::Node> &nodes) {
+LogicalType YAMLReader::DetectJaggedYAMLType(const vector<YAML::Node> &nodes,
+                                             const YAMLScalarOptions *scalar_options) {
 	if (nodes.empty()) {
 		return LogicalType::VARCHAR;
 	}
 
 	// Use first node as base type
-	LogicalType merged_type = DetectYAMLType(nodes[0]);
+	LogicalType merged_type = DetectYAMLType(nodes[0], scalar_options);
 
 	// Merge types from all subsequent documents
 	for (size_t i = 1; i < nodes.size(); i++) {
-		LogicalType node_type = DetectYAMLType(nodes[i]);
+		LogicalType node_type = DetectYAMLType(nodes[i], scalar_options);
 
 		// If both are structs, merge them recursively
 		if (merged_type.id() == LogicalTypeId::STRUCT && node_type.id() == LogicalTypeId::STRUCT) {
@@ -249,7 +661,7 @@ LogicalType YAMLReader::DetectJaggedYAMLType(const vector<YAML::Node> &nodes) {
 				// node_type is STRUCT, use it
 				merged_type = node_type;
 			}
-		} else if (merged_type.id() != node_type.id()) {
+		} else if (TypesNeedWidening(merged_type, node_type)) {
 			// Different scalar types across nodes - widen compatible numerics (TINYINT + SMALLINT
 			// -> SMALLINT, INT + DOUBLE -> DOUBLE); keep the VARCHAR fallback for genuinely
 			// incompatible pairs (issue #42).
@@ -268,7 +680,8 @@ LogicalType YAMLReader::DetectJaggedYAMLType(const vector<YAML::Node> &nodes) {
 // Budget-carrying worker (see DetectYAMLTypeImpl) — bounds recursion depth and
 // total node expansion so alias-bombed / deeply-nested input fails cleanly.
 static Value YAMLNodeToValueImpl(const YAML::Node &node, const LogicalType &target_type,
-                                 yaml_utils::YAMLTraversalBudget &budget) {
+                                 yaml_utils::YAMLTraversalBudget &budget,
+                                 const YAMLReader::YAMLScalarOptions *scalar_options) {
 	if (!node) {
 		return Value(target_type); // NULL value
 	}
@@ -306,6 +719,15 @@ static Value YAMLNodeToValueImpl(const YAML::Node &node, const LogicalType &targ
 		}
 	}
 
+#ifdef DUCKDB_HAS_VARIANT_TYPE
+	// VARIANT: typed by this value's own content, so the cost tracks the value rather than
+	// a schema shared with other rows
+	if (target_type.id() == LogicalTypeId::VARIANT) {
+		auto value_type = DetectYAMLTypeImpl(node, budget, scalar_options);
+		return YAMLNodeToValueImpl(node, value_type, budget, scalar_options).DefaultCastAs(target_type);
+	}
+#endif
+
 	// Handle YAML type conversion - applies to all node types
 	if (target_type.HasAlias() && target_type.GetAlias() == "yaml") {
 		// Emit as YAML string
@@ -319,6 +741,25 @@ static Value YAMLNodeToValueImpl(const YAML::Node &node, const LogicalType &targ
 	switch (node.Type()) {
 	case YAML::NodeType::Scalar: {
 		std::string scalar_value = node.Scalar();
+		if (scalar_options && scalar_options->schema != YAMLResolutionSchema::YAML11 && node.Tag() != "!") {
+			// Core / JSON schema: booleans are only the schema's literals, and 0x / 0o integers and
+			// the .inf / .nan spellings are rewritten into the forms the converters below accept
+			auto kind = ClassifyCoreScalar(scalar_value, scalar_options->schema == YAMLResolutionSchema::JSON);
+			if (target_type.id() == LogicalTypeId::BOOLEAN) {
+				if (kind != CoreScalarKind::BOOLEAN) {
+					return Value(target_type); // NULL if not a boolean literal
+				}
+				return Value::BOOLEAN(scalar_value[0] == 't' || scalar_value[0] == 'T');
+			}
+			int64_t int_val;
+			if ((kind == CoreScalarKind::HEX_INTEGER || kind == CoreScalarKind::OCTAL_INTEGER) &&
+			    TryParseRadixInteger(scalar_value, kind, int_val)) {
+				scalar_value = std::to_string(int_val);
+			} else if (kind == CoreScalarKind::FLOAT && std::isalpha(static_cast<unsigned char>(scalar_value.back()))) {
+				bool is_nan = scalar_value[1] == 'n' || scalar_value[1] == 'N';
+				scalar_value = is_nan ? "nan" : (scalar_value[0] == '-' ? "-inf" : "inf");
+			}
+		}
 
 		if (target_type.id() == LogicalTypeId::VARCHAR) {
 			return Value(scalar_value);
@@ -371,6 +812,36 @@ static Value YAMLNodeToValueImpl(const YAML::Node &node, const LogicalType &targ
 			} catch (...) {
 				return Value(target_type); // NULL if conversion fails
 			}
+		} else if (target_type.id() == LogicalTypeId::UBIGINT) {
+			uint64_t val;
+			if (TryCast::Operation<string_t, uint64_t>(string_t(scalar_value), val, true)) {
+				return Value::UBIGINT(val);
+			}
+			return Value(target_type); // NULL if conversion fails
+		} else if (target_type.id() == LogicalTypeId::HUGEINT) {
+			hugeint_t val;
+			if (TryCast::Operation<string_t, hugeint_t>(string_t(scalar_value), val, true)) {
+				return Value::HUGEINT(val);
+			}
+			return Value(target_type); // NULL if conversion fails
+		} else if (target_type.id() == LogicalTypeId::DECIMAL) {
+			Value val;
+			if (Value(scalar_value).DefaultTryCastAs(target_type, val, nullptr, true)) {
+				return val;
+			}
+			return Value(target_type); // NULL if conversion fails
+		} else if (target_type.id() == LogicalTypeId::BLOB && YAMLReader::IsBinaryNode(node)) {
+			string decoded;
+			if (TryDecodeBase64(scalar_value, decoded)) {
+				return Value::BLOB(const_data_ptr_cast(decoded.data()), decoded.size());
+			}
+			return Value(target_type); // NULL if not valid base64
+		} else if (target_type.id() == LogicalTypeId::UUID) {
+			hugeint_t val;
+			if (UUID::FromString(scalar_value, val)) {
+				return Value::UUID(val);
+			}
+			return Value(target_type); // NULL if not a valid UUID
 		} else if (target_type.id() == LogicalTypeId::DOUBLE) {
 			// Handle special floating point values
 			std::string lower_val = scalar_value;
@@ -391,6 +862,12 @@ static Value YAMLNodeToValueImpl(const YAML::Node &node, const LogicalType &targ
 				return Value(target_type); // NULL if conversion fails
 			}
 		} else if (target_type.id() == LogicalTypeId::DATE) {
+			string error_message;
+			date_t format_result;
+			if (scalar_options && scalar_options->has_date_format &&
+			    scalar_options->date_format.TryParseDate(string_t(scalar_value), format_result, error_message)) {
+				return Value::DATE(format_result);
+			}
 			idx_t pos = 0;
 			date_t date_result;
 			bool special = false;
@@ -401,7 +878,13 @@ static Value YAMLNodeToValueImpl(const YAML::Node &node, const LogicalType &targ
 			}
 			return Value(target_type); // NULL if conversion fails
 		} else if (target_type.id() == LogicalTypeId::TIMESTAMP) {
+			string error_message;
 			timestamp_t timestamp_result;
+			if (scalar_options && scalar_options->has_timestamp_format &&
+			    scalar_options->timestamp_format.TryParseTimestamp(string_t(scalar_value), timestamp_result,
+			                                                       error_message)) {
+				return Value::TIMESTAMP(timestamp_result);
+			}
 			if (Timestamp::TryConvertTimestamp(scalar_value.c_str(), scalar_value.length(), timestamp_result, false) ==
 			    TimestampCastResult::SUCCESS) {
 				return Value::TIMESTAMP(timestamp_result);
@@ -415,10 +898,17 @@ static Value YAMLNodeToValueImpl(const YAML::Node &node, const LogicalType &targ
 				return Value::TIME(time_result);
 			}
 			return Value(target_type); // NULL if conversion fails
+		} else if (target_type.id() == LogicalTypeId::ENUM) {
+			auto pos = EnumType::GetPos(target_type, string_t(scalar_value));
+			if (pos < 0) {
+				return Value(target_type); // NULL if not one of the enum values
+			}
+			return Value::ENUM(NumericCast<uint64_t>(pos), target_type);
 		}
-		// If target type is STRUCT or LIST but we have a scalar, return NULL
+		// If target type is STRUCT, LIST or MAP but we have a scalar, return NULL
 		// This handles type mismatches where schema detection saw a different type
-		if (target_type.id() == LogicalTypeId::STRUCT || target_type.id() == LogicalTypeId::LIST) {
+		if (target_type.id() == LogicalTypeId::STRUCT || target_type.id() == LogicalTypeId::LIST ||
+		    target_type.id() == LogicalTypeId::MAP) {
 			return Value(target_type); // NULL for type mismatch
 		}
 		return Value(scalar_value); // Default to string
@@ -449,12 +939,24 @@ static Value YAMLNodeToValueImpl(const YAML::Node &node, const LogicalType &targ
 		// Create list of values - recursively convert each element
 		vector<Value> values;
 		for (size_t idx = 0; idx < node.size(); idx++) {
-			values.push_back(YAMLNodeToValueImpl(node[idx], child_type, budget));
+			values.push_back(YAMLNodeToValueImpl(node[idx], child_type, budget, scalar_options));
 		}
 
 		return Value::LIST(values);
 	}
 	case YAML::NodeType::Map: {
+		if (target_type.id() == LogicalTypeId::MAP) {
+			// Free-form maps (e.g. additionalProperties in a schema_file)
+			auto &key_type = MapType::KeyType(target_type);
+			auto &value_type = MapType::ValueType(target_type);
+			vector<Value> keys;
+			vector<Value> values;
+			for (auto it = node.begin(); it != node.end(); ++it) {
+				keys.push_back(YAMLNodeToValueImpl(it->first, key_type, budget, scalar_options));
+				values.push_back(YAMLNodeToValueImpl(it->second, value_type, budget, scalar_options));
+			}
+			return Value::MAP(key_type, value_type, std::move(keys), std::move(values));
+		}
 		if (target_type.id() != LogicalTypeId::STRUCT) {
 			return Value(target_type); // NULL if not expecting a struct
 		}
@@ -467,7 +969,8 @@ static Value YAMLNodeToValueImpl(const YAML::Node &node, const LogicalType &targ
 		for (auto &entry : struct_children) {
 			auto entry_name = CompatIdentifierName(entry.first);
 			if (node[entry_name]) {
-				struct_values.push_back(make_pair(entry.first, YAMLNodeToValueImpl(node[entry_name], entry.second, budget)));
+				struct_values.push_back(make_pair(
+				    entry.first, YAMLNodeToValueImpl(node[entry_name], entry.second, budget, scalar_options)));
 			} else {
 				struct_values.push_back(make_pair(entry.first, Value(entry.second))); // NULL value
 			}
@@ -480,9 +983,10 @@ static Value YAMLNodeToValueImpl(const YAML::Node &node, const LogicalType &targ
 	}
 }
 
-Value YAMLReader::YAMLNodeToValue(const YAML::Node &node, const LogicalType &target_type) {
+Value YAMLReader::YAMLNodeToValue(const YAML::Node &node, const LogicalType &target_type,
+                                  const YAMLScalarOptions *scalar_options) {
 	yaml_utils::YAMLTraversalBudget budget;
-	return YAMLNodeToValueImpl(node, target_type, budget);
+	return YAMLNodeToValueImpl(node, target_type, budget, scalar_options);
 }
 
 } // namespace duckdb
@@ -39,8 +39,8 @@ void YAMLFunctions::RegisterValidationFunction(ExtensionLoader &loader) {
 			                                      try {
 				                                      // Check if it's a multi-document YAML by trying to load all
 				                                      // documents
-				                                      std::stringstream yaml_stream(yaml_str.GetString());
-				                                      std::vector<YAML::Node> docs = YAML::LoadAll(yaml_stream);
+				                                      std::vector<YAML::Node> docs =
+				                                          yaml_utils::LoadAllYAML(yaml_str.GetString());
 				                                      return !docs.empty();
 			                                      } catch (...) {
 				                                      return false;
@@ -66,6 +66,7 @@ void YAMLFunctions::RegisterValidationFunction(ExtensionLoader &loader) {
 //===--------------------------------------------------------------------===//
 
 static void YAMLToJSONFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(state.GetContext());
 	UnaryExecutor::Execute<string_t, string_t>(args.data[0], result, args.size(), [&](string_t yaml_str) -> string_t {
 		if (yaml_str.GetSize() == 0) {
 			return string_t();
@@ -95,13 +96,17 @@ static void YAMLToJSONFunction(DataChunk &args, ExpressionState &state, Vector &
 			}
 
 			return StringVector::AddString(result, json_str.c_str(), json_str.length());
+		} catch (const InterruptException &) {
+			throw;
 		} catch (const std::exception &e) {
 			throw InvalidInputException("Error converting YAML to JSON: %s", e.what());
 		}
 	});
+	yaml_utils::CheckInterrupted();
 }
 
 static void ValueToYAMLFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(state.GetContext());
 	auto &input = args.data[0];
 
 	// Process each row
@@ -121,6 +126,7 @@ static void ValueToYAMLFunction(DataChunk &args, ExpressionState &state, Vector
 			result.SetValue(row_idx, Value("null"));
 		}
 	}
+	yaml_utils::CheckInterrupted();
 }
 
 //===--------------------------------------------------------------------===//
@@ -178,7 +184,8 @@ static unique_ptr<FunctionData> FormatYAMLBind(DUCKDB_SCALAR_BIND_PARAMS) {
 		}
 
 		// Validate known parameter names
-		if (param_name == "style" || param_name == "multiline" || param_name == "indent") {
+		if (param_name == "style" || param_name == "multiline" || param_name == "indent" ||
+		    param_name == "deduplicate") {
 			// Valid parameter, will be processed in execution function
 		} else {
 			throw BinderException("Unknown parameter '%s' for format_yaml", param_name);
@@ -190,10 +197,12 @@ static unique_ptr<FunctionData> FormatYAMLBind(DUCKDB_SCALAR_BIND_PARAMS) {
 }
 
 static void FormatYAMLFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(state.GetContext());
 	auto &input = args.data[0];
 	yaml_utils::YAMLFormat format = yaml_utils::YAMLSettings::GetDefaultFormat();
 	yaml_utils::YAMLStringStyle string_style = yaml_utils::YAMLStringStyle::AUTO;
 	idx_t indent = 2;
+	bool deduplicate = false;
 
 	// Access named parameters from the bound function expression (like struct_update)
 	auto &func_args = CompatBoundChildren(state.expr.Cast<BoundFunctionExpression>());
@@ -244,6 +253,10 @@ static void FormatYAMLFunction(DataChunk &args, ExpressionState &state, Vector &
 				throw InvalidInputException("Invalid YAML indent '%s'. Must be an integer between 1 and 10.",
 				                            indent_value.ToString());
 			}
+		} else if (param_name == "deduplicate") {
+			Value deduplicate_value = args.data[arg_idx].GetValue(0);
+			deduplicate = !deduplicate_value.IsNull() &&
+			              BooleanValue::Get(deduplicate_value.DefaultCastAs(LogicalType::BOOLEAN));
 		} else {
 			throw InvalidInputException("Unknown parameter '%s' for format_yaml", param_name);
 		}
@@ -256,8 +269,8 @@ static void FormatYAMLFunction(DataChunk &args, ExpressionState &state, Vector &
 
 		// YAML generation using determined parameters
 		try {
-			// Format the value as YAML with the specified style, multiline, and indent
-			std::string yaml_str = yaml_utils::ValueToYAMLString(value, format, string_style, indent);
+			// Format the value as YAML with the specified style, multiline, indent, and deduplication
+			std::string yaml_str = yaml_utils::ValueToYAMLString(value, format, string_style, indent, deduplicate);
 			result.SetValue(row_idx, Value(yaml_str));
 		} catch (const std::exception &e) {
 			// Only catch YAML generation errors, return null for data conversion issues
@@ -267,6 +280,7 @@ static void FormatYAMLFunction(DataChunk &args, ExpressionState &state, Vector &
 			result.SetValue(row_idx, Value("null"));
 		}
 	}
+	yaml_utils::CheckInterrupted();
 }
 
 void YAMLFunctions::RegisterYAMLTypeFunctions(ExtensionLoader &loader) {
@@ -300,7 +314,7 @@ void YAMLFunctions::RegisterYAMLTypeFunctions(ExtensionLoader &loader) {
 			    yaml_utils::CheckInputSize(input_str.size(), "yaml");
 			    // Validate that it's valid YAML by parsing it
 			    try {
-				    YAML::Load(input_str);
+				    yaml_utils::LoadYAML(input_str);
 				    // If parsing succeeds, return the input as a YAML value
 				    return StringVector::AddString(result, input_str);
 			    } catch (const YAML::Exception &e) {
@@ -361,6 +375,7 @@ void YAMLFunctions::RegisterStyleFunctions(ExtensionLoader &loader) {
 	loader.RegisterFunction(yaml_get_default_style_fun);
 
 	RegisterLimitFunctions(loader);
+	RegisterSchemaCacheFunctions(loader);
 }
 
 //===--------------------------------------------------------------------===//
@@ -412,6 +427,44 @@ void YAMLFunctions::RegisterLimitFunctions(ExtensionLoader &loader) {
 	loader.RegisterFunction(
 	    MakeLimitSetter<YAMLSettings::SetMaxInputSize, YAMLSettings::GetMaxInputSize>("yaml_set_max_input_size"));
 	loader.RegisterFunction(MakeLimitGetter<YAMLSettings::GetMaxInputSize>("yaml_get_max_input_size"));
+	loader.RegisterFunction(MakeLimitSetter<YAMLSettings::SetMaxAliasReferences, YAMLSettings::GetMaxAliasReferences>(
+	    "yaml_set_max_alias_references"));
+	loader.RegisterFunction(MakeLimitGetter<YAMLSettings::GetMaxAliasReferences>("yaml_get_max_alias_references"));
+}
+
+//===--------------------------------------------------------------------===//
+// Schema cache functions
+//===--------------------------------------------------------------------===//
+// read_yaml can reuse the schema it detected for the same arguments while the file
+// listing and the sampled files are unchanged (see YAMLReader::ClearSchemaCache).
+
+static void YAMLSetSchemaCacheFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::Execute<bool, bool>(args.data[0], result, args.size(), [&](bool enabled) {
+		yaml_utils::YAMLSettings::SetSchemaCacheEnabled(enabled);
+		if (!enabled) {
+			YAMLReader::ClearSchemaCache();
+		}
+		return enabled;
+	});
+}
+
+static void YAMLGetSchemaCacheFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	ConstantVector::GetData<bool>(result)[0] = yaml_utils::YAMLSettings::GetSchemaCacheEnabled();
+}
+
+static void YAMLClearSchemaCacheFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	ConstantVector::GetData<int64_t>(result)[0] = static_cast<int64_t>(YAMLReader::ClearSchemaCache());
+}
+
+void YAMLFunctions::RegisterSchemaCacheFunctions(ExtensionLoader &loader) {
+	loader.RegisterFunction(ScalarFunction("yaml_set_schema_cache", {LogicalType::BOOLEAN}, LogicalType::BOOLEAN,
+	                                       YAMLSetSchemaCacheFunction));
+	loader.RegisterFunction(
+	    ScalarFunction("yaml_get_schema_cache", {}, LogicalType::BOOLEAN, YAMLGetSchemaCacheFunction));
+	loader.RegisterFunction(
+	    ScalarFunction("yaml_clear_schema_cache", {}, LogicalType::BIGINT, YAMLClearSchemaCacheFunction));
 }
 
 //===--------------------------------------------------------------------===//
@@ -466,6 +519,7 @@ static unique_ptr<FunctionData> FromYAMLBind(DUCKDB_SCALAR_BIND_PARAMS) {
 }
 
 static void FromYAMLFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	yaml_utils::YAMLInterruptScope interrupt_scope(state.GetContext());
 	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
 	auto &bind_data = CompatBoundBindInfo(func_expr)->Cast<FromYAMLBindData>();
 	auto &target_type = bind_data.target_type;
@@ -485,15 +539,18 @@ static void FromYAMLFunction(DataChunk &args, ExpressionState &state, Vector &re
 			// Get YAML string and parse it
 			std::string yaml_str = yaml_value.ToString();
 			yaml_utils::CheckInputSize(yaml_str.size(), "from_yaml");
-			YAML::Node node = YAML::Load(yaml_str);
+			YAML::Node node = yaml_utils::LoadYAML(yaml_str);
 
 			// Convert to the target type using existing conversion function
 			Value converted = YAMLReader::YAMLNodeToValue(node, target_type);
 			result.SetValue(row_idx, converted);
+		} catch (const InterruptException &) {
+			throw;
 		} catch (const std::exception &e) {
 			throw InvalidInputException("Error converting YAML to type '%s': %s", target_type.ToString(), e.what());
 		}
 	}
+	yaml_utils::CheckInterrupted();
 }
 
 void YAMLFunctions::RegisterFromYAMLFunction(ExtensionLoader &loader) {
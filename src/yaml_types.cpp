@@ -69,7 +69,7 @@ static bool JSONToYAMLCast(Vector &source, Vector &result, idx_t count, CastPara
 
 		try {
 			// Parse JSON using YAML parser
-			YAML::Node json_node = YAML::Load(json_str.GetString());
+			YAML::Node json_node = yaml_utils::LoadYAML(json_str.GetString());
 
 			// Generate YAML with block formatting
 			std::string yaml_str = yaml_utils::EmitYAML(json_node, yaml_utils::YAMLFormat::BLOCK);
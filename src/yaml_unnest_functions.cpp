@@ -129,7 +129,7 @@ static void YAMLArrayLengthUnaryFunction(DataChunk &args, ExpressionState &state
 			    return 0;
 		    }
 		    try {
-			    YAML::Node node = YAML::Load(yaml_str.GetString());
+			    YAML::Node node = yaml_utils::LoadYAML(yaml_str.GetString());
 			    if (!node.IsSequence()) {
 				    mask.SetInvalid(idx); // Not an array → SQL NULL
 				    return 0;
@@ -150,7 +150,7 @@ static void YAMLArrayLengthBinaryFunction(DataChunk &args, ExpressionState &stat
 			    return 0;
 		    }
 		    try {
-			    YAML::Node root = YAML::Load(yaml_str.GetString());
+			    YAML::Node root = yaml_utils::LoadYAML(yaml_str.GetString());
 			    auto path_components = ParseYAMLPath(path_str.GetString());
 			    auto node = ExtractFromYAML(root, path_components);
 			    if (!node || !node.IsSequence()) {
@@ -177,7 +177,7 @@ static void YAMLKeysUnaryFunction(DataChunk &args, ExpressionState &state, Vecto
 			    return {0, 0};
 		    }
 		    try {
-			    YAML::Node node = YAML::Load(yaml_str.GetString());
+			    YAML::Node node = yaml_utils::LoadYAML(yaml_str.GetString());
 			    if (!node.IsMap()) {
 				    mask.SetInvalid(idx); // Not an object → SQL NULL
 				    return {0, 0};
@@ -222,7 +222,7 @@ static void YAMLKeysBinaryFunction(DataChunk &args, ExpressionState &state, Vect
 			    return {0, 0};
 		    }
 		    try {
-			    YAML::Node root = YAML::Load(yaml_str.GetString());
+			    YAML::Node root = yaml_utils::LoadYAML(yaml_str.GetString());
 			    auto path_components = ParseYAMLPath(path_str.GetString());
 			    auto node = ExtractFromYAML(root, path_components);
 			    if (!node || !node.IsMap()) {
@@ -281,20 +281,17 @@ static unique_ptr<FunctionData> YAMLArrayElementsBind(ClientContext &context, Ta
 		string yaml_str = yaml_value.ToString();
 
 		try {
-			YAML::Node node = YAML::Load(yaml_str);
+			yaml_utils::YAMLSourceMarks marks;
+			YAML::Node node = yaml_utils::LoadYAML(yaml_str, marks);
 
 			if (!node.IsSequence()) {
 				throw BinderException("yaml_array_elements requires a YAML array");
 			}
 
-			// Store all elements as YAML strings
+			// Store all elements as YAML strings, taken from the input where possible
 			for (size_t i = 0; i < node.size(); i++) {
-				YAML::Emitter out;
-				out.SetIndent(2);
-				out.SetMapFormat(YAML::Flow);
-				out.SetSeqFormat(YAML::Flow);
-				out << node[i];
-				result->elements.push_back(out.c_str());
+				auto element_marks = i < marks.children.size() ? &marks.children[i] : nullptr;
+				result->elements.push_back(yaml_utils::YAMLNodeSourceText(yaml_str, node[i], element_marks));
 			}
 		} catch (const YAML::Exception &e) {
 			throw BinderException("Error parsing YAML: %s", e.what());
@@ -356,23 +353,19 @@ static unique_ptr<FunctionData> YAMLEachBind(ClientContext &context, TableFuncti
 		string yaml_str = yaml_value.ToString();
 
 		try {
-			YAML::Node node = YAML::Load(yaml_str);
+			yaml_utils::YAMLSourceMarks marks;
+			YAML::Node node = yaml_utils::LoadYAML(yaml_str, marks);
 
 			if (!node.IsMap()) {
 				throw BinderException("yaml_each requires a YAML object");
 			}
 
-			// Store all key-value pairs as strings
-			for (auto it = node.begin(); it != node.end(); ++it) {
+			// Store all key-value pairs as strings, taking values from the input where possible
+			idx_t entry_idx = 0;
+			for (auto it = node.begin(); it != node.end(); ++it, entry_idx++) {
 				string key = it->first.Scalar();
-
-				YAML::Emitter out;
-				out.SetIndent(2);
-				out.SetMapFormat(YAML::Flow);
-				out.SetSeqFormat(YAML::Flow);
-				out << it->second;
-
-				result->entries.push_back({key, out.c_str()});
+				auto value_marks = entry_idx < marks.children.size() ? &marks.children[entry_idx] : nullptr;
+				result->entries.push_back({key, yaml_utils::YAMLNodeSourceText(yaml_str, it->second, value_marks)});
 			}
 		} catch (const YAML::Exception &e) {
 			throw BinderException("Error parsing YAML: %s", e.what());
@@ -418,6 +411,198 @@ static void YAMLEachFunction(ClientContext &context, TableFunctionInput &data_p,
 	CompatSetOutputCardinality(output, count);
 }
 
+//===--------------------------------------------------------------------===//
+// yaml_tree - Table In-Out Function
+//===--------------------------------------------------------------------===//
+
+// Output columns of yaml_tree
+static constexpr idx_t YAML_TREE_PATH = 0;
+static constexpr idx_t YAML_TREE_KEY = 1;
+static constexpr idx_t YAML_TREE_VALUE = 2;
+static constexpr idx_t YAML_TREE_TYPE = 3;
+static constexpr idx_t YAML_TREE_DEPTH = 4;
+static constexpr idx_t YAML_TREE_ID = 5;
+static constexpr idx_t YAML_TREE_PARENT = 6;
+
+// A collection whose children are still being emitted
+struct YAMLTreeFrame {
+	YAML::Node node;
+	YAML::const_iterator next_child;
+	idx_t child_index;
+	idx_t path_length; // Length of the collection's own path in the path buffer
+	int64_t id;
+	int32_t depth;
+};
+
+// Traversal state, kept across calls so large documents are streamed over several chunks
+struct YAMLTreeLocalState : public LocalTableFunctionState {
+	idx_t input_row = 0;     // Row of the current input chunk being flattened
+	bool row_loaded = false; // Whether the documents of input_row have been parsed
+	vector<YAML::Node> documents;
+	idx_t document_idx = 0; // Next document to start
+	vector<YAMLTreeFrame> stack;
+	string path; // Path of the current node, truncated and extended in place
+	int64_t next_id = 0;
+};
+
+static unique_ptr<FunctionData> YAMLTreeBind(ClientContext &context, TableFunctionBindInput &input,
+                                             vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"path", "key", "value", "type", "depth", "id", "parent"};
+	return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, YAMLTypes::YAMLType(), LogicalType::VARCHAR,
+	                LogicalType::INTEGER, LogicalType::BIGINT,   LogicalType::BIGINT};
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<LocalTableFunctionState> YAMLTreeInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                             GlobalTableFunctionState *global_state) {
+	return make_uniq<YAMLTreeLocalState>();
+}
+
+static const char *YAMLTreeTypeName(const YAML::Node &node) {
+	switch (node.Type()) {
+	case YAML::NodeType::Map:
+		return "object";
+	case YAML::NodeType::Sequence:
+		return "array";
+	case YAML::NodeType::Scalar:
+		return "scalar";
+	default:
+		return "null";
+	}
+}
+
+static void SetTreeString(DataChunk &output, idx_t column, idx_t row, const string &value) {
+	// const_cast: see comment in YAMLKeysUnaryFunction above.
+	auto data = const_cast<string_t *>(FlatVector::GetData<string_t>(output.data[column]));
+	data[row] = StringVector::AddString(output.data[column], value);
+}
+
+template <class T>
+static void SetTreeNumber(DataChunk &output, idx_t column, idx_t row, T value) {
+	auto data = const_cast<T *>(FlatVector::GetData<T>(output.data[column]));
+	data[row] = value;
+}
+
+// Write one node as an output row; non-empty collections are pushed so their children follow
+static void EmitYAMLTreeNode(YAMLTreeLocalState &state, DataChunk &output, idx_t row, const YAML::Node &node,
+                             const string *key, int64_t parent_id, int32_t depth) {
+	auto id = state.next_id++;
+	SetTreeString(output, YAML_TREE_PATH, row, state.path);
+	if (key) {
+		SetTreeString(output, YAML_TREE_KEY, row, *key);
+	} else {
+		FlatVector::SetNull(output.data[YAML_TREE_KEY], row, true);
+	}
+	SetTreeString(output, YAML_TREE_VALUE, row, yaml_utils::EmitYAML(node, yaml_utils::YAMLFormat::FLOW));
+	SetTreeString(output, YAML_TREE_TYPE, row, YAMLTreeTypeName(node));
+	SetTreeNumber<int32_t>(output, YAML_TREE_DEPTH, row, depth);
+	SetTreeNumber<int64_t>(output, YAML_TREE_ID, row, id);
+	if (parent_id >= 0) {
+		SetTreeNumber<int64_t>(output, YAML_TREE_PARENT, row, parent_id);
+	} else {
+		FlatVector::SetNull(output.data[YAML_TREE_PARENT], row, true);
+	}
+
+	if ((node.IsMap() || node.IsSequence()) && node.size() > 0) {
+		state.stack.push_back({node, node.begin(), 0, state.path.size(), id, depth});
+	}
+}
+
+// Emit nodes of the current input row in pre-order until the row or the output chunk is exhausted
+static idx_t FlattenYAMLTree(YAMLTreeLocalState &state, DataChunk &output, idx_t count) {
+	while (count < STANDARD_VECTOR_SIZE) {
+		if (state.stack.empty()) {
+			if (state.document_idx >= state.documents.size()) {
+				break;
+			}
+			state.path = "$";
+			EmitYAMLTreeNode(state, output, count++, state.documents[state.document_idx++], nullptr, -1, 0);
+			continue;
+		}
+
+		auto &frame = state.stack.back();
+		if (frame.next_child == frame.node.end()) {
+			state.stack.pop_back();
+			continue;
+		}
+		state.path.resize(frame.path_length);
+		string key;
+		if (frame.node.IsMap()) {
+			YAML::Node key_node = frame.next_child->first;
+			key = key_node.IsScalar() ? key_node.Scalar()
+			                          : yaml_utils::EmitYAML(key_node, yaml_utils::YAMLFormat::FLOW);
+			yaml_utils::AppendYAMLPathKey(state.path, key);
+		} else {
+			key = std::to_string(frame.child_index);
+			state.path += '[';
+			state.path += key;
+			state.path += ']';
+		}
+		YAML::Node child = frame.node.IsMap() ? YAML::Node(frame.next_child->second) : YAML::Node(*frame.next_child);
+		++frame.next_child;
+		frame.child_index++;
+		// Emitting may push onto the stack, invalidating frame
+		auto parent_id = frame.id;
+		auto depth = frame.depth + 1;
+		EmitYAMLTreeNode(state, output, count++, child, &key, parent_id, depth);
+	}
+	return count;
+}
+
+static void LoadYAMLTreeRow(YAMLTreeLocalState &state, UnifiedVectorFormat &input_data) {
+	state.documents.clear();
+	state.stack.clear();
+	state.document_idx = 0;
+	state.next_id = 0;
+	state.row_loaded = true;
+
+	auto input_idx = input_data.sel->get_index(state.input_row);
+	if (!input_data.validity.RowIsValid(input_idx)) {
+		return; // NULL input produces no rows
+	}
+	auto &yaml_str = UnifiedVectorFormat::GetData<string_t>(input_data)[input_idx];
+	try {
+		yaml_utils::CheckInputSize(yaml_str.GetSize(), "yaml_tree");
+		state.documents = yaml_utils::LoadAllYAML(yaml_str.GetString());
+		// Bound expansion before walking: aliases are walked once per reference
+		for (auto &document : state.documents) {
+			yaml_utils::CheckExpansionBudget(document);
+		}
+	} catch (const InvalidInputException &) {
+		throw;
+	} catch (const InterruptException &) {
+		throw;
+	} catch (const std::exception &e) {
+		throw InvalidInputException("Error in yaml_tree: %s", e.what());
+	}
+}
+
+static OperatorResultType YAMLTreeFunction(ExecutionContext &context, TableFunctionInput &data_p, DataChunk &input,
+                                           DataChunk &output) {
+	auto &state = data_p.local_state->Cast<YAMLTreeLocalState>();
+	UnifiedVectorFormat input_data;
+	input.data[0].ToUnifiedFormat(input.size(), input_data);
+
+	idx_t count = 0;
+	while (state.input_row < input.size()) {
+		if (!state.row_loaded) {
+			LoadYAMLTreeRow(state, input_data);
+		}
+		count = FlattenYAMLTree(state, output, count);
+		if (!state.stack.empty() || state.document_idx < state.documents.size()) {
+			// The output chunk is full: continue with this row on the next call
+			CompatSetOutputCardinality(output, count);
+			return OperatorResultType::HAVE_MORE_OUTPUT;
+		}
+		state.input_row++;
+		state.row_loaded = false;
+	}
+
+	state.input_row = 0;
+	CompatSetOutputCardinality(output, count);
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
 //===--------------------------------------------------------------------===//
 // yaml_build_object
 //===--------------------------------------------------------------------===//
@@ -459,7 +644,7 @@ static void YAMLBuildObjectFunction(DataChunk &args, ExpressionState &state, Vec
 				// Try to parse as YAML first (if it's a YAML type)
 				string val_str = value_val.ToString();
 				try {
-					YAML::Node parsed = YAML::Load(val_str);
+					YAML::Node parsed = yaml_utils::LoadYAML(val_str);
 					obj_node[key] = parsed;
 				} catch (...) {
 					// If parsing fails, treat as scalar
@@ -619,7 +804,7 @@ static void YAMLAggFinalize(Vector &state_vector, DUCKDB_AGG_FINALIZE_INPUT_TYPE
 			idx_t elem_len = strlen(elem_str);
 
 			try {
-				YAML::Node node = YAML::Load(elem_str);
+				YAML::Node node = yaml_utils::LoadYAML(elem_str);
 				array_node.push_back(node);
 			} catch (...) {
 				// If parsing fails, treat as scalar string
@@ -671,6 +856,15 @@ void YAMLUnnestFunctions::Register(ExtensionLoader &loader) {
 	TableFunction yaml_each("yaml_each", {yaml_type}, YAMLEachFunction, YAMLEachBind);
 	loader.RegisterFunction(yaml_each);
 
+	// yaml_tree in-out function - one row per node, usable laterally on a column
+	TableFunctionSet yaml_tree_set("yaml_tree");
+	for (auto &input_type : vector<LogicalType> {yaml_type, LogicalType::VARCHAR}) {
+		TableFunction yaml_tree("yaml_tree", {input_type}, nullptr, YAMLTreeBind, nullptr, YAMLTreeInitLocal);
+		yaml_tree.in_out_function = YAMLTreeFunction;
+		yaml_tree_set.AddFunction(yaml_tree);
+	}
+	loader.RegisterFunction(yaml_tree_set);
+
 	// yaml_build_object function - variadic function
 	auto yaml_build_object_fun = ScalarFunction("yaml_build_object", {}, yaml_type, YAMLBuildObjectFunction);
 	CompatSetScalarVarArgs(yaml_build_object_fun, LogicalType::ANY);
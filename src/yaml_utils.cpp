@@ -5,11 +5,17 @@
 #include "duckdb/common/types/date.hpp"
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/function/cast/default_casts.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "yaml-cpp/eventhandler.h"
+#include "yaml-cpp/parser.h"
 #include <sstream>
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <cstring>
+#include <unordered_map>
 
 namespace duckdb {
 
@@ -26,6 +32,8 @@ YAMLFormat YAMLSettings::default_format = YAMLFormat::FLOW;
 idx_t YAMLSettings::max_expansion_nodes = YAML_DEFAULT_MAX_EXPANSION_NODES;
 idx_t YAMLSettings::max_nesting_depth = YAML_DEFAULT_MAX_NESTING_DEPTH;
 idx_t YAMLSettings::max_input_size = YAML_DEFAULT_MAX_INPUT_SIZE;
+idx_t YAMLSettings::max_alias_references = YAML_DEFAULT_MAX_ALIAS_REFERENCES;
+bool YAMLSettings::schema_cache_enabled = false;
 
 YAMLFormat YAMLSettings::GetDefaultFormat() {
 	return default_format;
@@ -53,26 +61,49 @@ void YAMLSettings::SetMaxInputSize(idx_t value) {
 idx_t YAMLSettings::GetMaxInputSize() {
 	return max_input_size;
 }
+void YAMLSettings::SetMaxAliasReferences(idx_t value) {
+	max_alias_references = value;
+}
+idx_t YAMLSettings::GetMaxAliasReferences() {
+	return max_alias_references;
+}
+void YAMLSettings::SetSchemaCacheEnabled(bool value) {
+	schema_cache_enabled = value;
+}
+bool YAMLSettings::GetSchemaCacheEnabled() {
+	return schema_cache_enabled;
+}
 
 //===--------------------------------------------------------------------===//
 // Traversal budget / input-size guard (GHSA-h5hw-g5m6-vmjj)
 //===--------------------------------------------------------------------===//
 
+static void ThrowNodeBudgetExceeded(idx_t max_nodes) {
+	throw InvalidInputException(
+	    "YAML expansion exceeded the maximum node budget (%llu); the input may contain an alias/anchor "
+	    "expansion bomb. Raise the limit with yaml_set_max_expansion_nodes(N) if this is a legitimate document.",
+	    (unsigned long long)max_nodes);
+}
+
+static void ThrowNestingDepthExceeded(idx_t max_depth) {
+	throw InvalidInputException(
+	    "YAML nesting exceeded the maximum depth (%llu). Raise the limit with yaml_set_max_nesting_depth(N) if "
+	    "this is a legitimate document.",
+	    (unsigned long long)max_depth);
+}
+
 YAMLBudgetScope::YAMLBudgetScope(YAMLTraversalBudget &budget_p) : budget(budget_p) {
 	// Count this node visit first. The counter is cumulative and is never
 	// decremented, so exponential re-materialization of shared alias nodes is
 	// bounded regardless of depth.
 	if (++budget.nodes > budget.max_nodes) {
-		throw InvalidInputException(
-		    "YAML expansion exceeded the maximum node budget (%llu); the input may contain an alias/anchor "
-		    "expansion bomb. Raise the limit with yaml_set_max_expansion_nodes(N) if this is a legitimate document.",
-		    (unsigned long long)budget.max_nodes);
+		ThrowNodeBudgetExceeded(budget.max_nodes);
+	}
+	if ((budget.nodes & (YAML_INTERRUPT_CHECK_INTERVAL - 1)) == 0) {
+		CheckInterrupted();
 	}
 	if (++budget.depth > budget.max_depth) {
-		throw InvalidInputException(
-		    "YAML nesting exceeded the maximum depth (%llu). Raise the limit with yaml_set_max_nesting_depth(N) if "
-		    "this is a legitimate document.",
-		    (unsigned long long)budget.max_depth);
+		ThrowNestingDepthExceeded(budget.max_depth);
 	}
 }
 
@@ -80,6 +111,38 @@ YAMLBudgetScope::~YAMLBudgetScope() {
 	--budget.depth;
 }
 
+//===--------------------------------------------------------------------===//
+// Interrupt checkpoints
+//===--------------------------------------------------------------------===//
+
+// Client whose interrupt flag is polled by the checkpoints on this thread
+static thread_local ClientContext *interrupt_context = nullptr;
+
+YAMLInterruptScope::YAMLInterruptScope(ClientContext &context) : previous(interrupt_context) {
+	interrupt_context = &context;
+}
+
+YAMLInterruptScope::~YAMLInterruptScope() {
+	interrupt_context = previous;
+}
+
+void CheckInterrupted() {
+	if (interrupt_context && interrupt_context->interrupted) {
+		throw InterruptException();
+	}
+}
+
+// Scalar size cap of the active YAMLScalarSizeScope, 0 outside of one
+static thread_local idx_t scope_max_scalar_size = 0;
+
+YAMLScalarSizeScope::YAMLScalarSizeScope(idx_t max_scalar_size) : previous(scope_max_scalar_size) {
+	scope_max_scalar_size = max_scalar_size;
+}
+
+YAMLScalarSizeScope::~YAMLScalarSizeScope() {
+	scope_max_scalar_size = previous;
+}
+
 void CheckInputSize(idx_t size, const char *context) {
 	idx_t limit = YAMLSettings::GetMaxInputSize();
 	if (size > limit) {
@@ -89,6 +152,92 @@ void CheckInputSize(idx_t size, const char *context) {
 	}
 }
 
+// Glob match of a single pattern (no brace alternatives)
+static bool MatchGlob(const char *name, const char *pattern) {
+	while (*pattern) {
+		if (pattern[0] == '*' && pattern[1] == '*') {
+			pattern += 2;
+			if (*pattern == '/' && MatchGlob(name, pattern + 1)) {
+				return true;
+			}
+			for (const char *rest = name;; rest++) {
+				if (MatchGlob(rest, pattern)) {
+					return true;
+				}
+				if (!*rest) {
+					return false;
+				}
+			}
+		}
+		if (*pattern == '*') {
+			pattern++;
+			for (const char *rest = name;; rest++) {
+				if (MatchGlob(rest, pattern)) {
+					return true;
+				}
+				if (!*rest || *rest == '/') {
+					return false;
+				}
+			}
+		}
+		if (!*name || (*pattern == '?' ? *name == '/' : *pattern != *name)) {
+			return false;
+		}
+		name++;
+		pattern++;
+	}
+	return !*name;
+}
+
+// Expand "{a,b}" alternatives into one pattern per combination
+static void ExpandBraces(const string &pattern, vector<string> &result) {
+	auto open = pattern.find('{');
+	auto close = open == string::npos ? string::npos : pattern.find('}', open);
+	if (close == string::npos) {
+		result.push_back(pattern);
+		return;
+	}
+	auto prefix = pattern.substr(0, open);
+	auto suffix = pattern.substr(close + 1);
+	idx_t start = open + 1;
+	while (true) {
+		auto comma = pattern.find(',', start);
+		auto end = comma == string::npos || comma > close ? close : comma;
+		ExpandBraces(prefix + pattern.substr(start, end - start) + suffix, result);
+		if (end == close) {
+			break;
+		}
+		start = end + 1;
+	}
+}
+
+bool MatchPathPattern(const string &path, const string &pattern) {
+	vector<string> alternatives;
+	ExpandBraces(pattern, alternatives);
+	for (auto &alternative : alternatives) {
+		if (MatchGlob(path.c_str(), alternative.c_str())) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void AppendYAMLPathKey(string &path, const string &key) {
+	path += '.';
+	if (!key.empty() && key.find_first_of(".[]'\"\\") == string::npos) {
+		path += key;
+		return;
+	}
+	path += '"';
+	for (char c : key) {
+		if (c == '"' || c == '\'' || c == '\\') {
+			path += '\\';
+		}
+		path += c;
+	}
+	path += '"';
+}
+
 static void CheckExpansionBudgetImpl(const YAML::Node &node, YAMLTraversalBudget &budget) {
 	if (!node) {
 		return;
@@ -125,19 +274,241 @@ std::vector<YAML::Node> ParseYAML(const std::string &yaml_str, bool multi_doc) {
 	}
 
 	try {
-		std::stringstream yaml_stream(yaml_str);
 		if (multi_doc) {
-			return YAML::LoadAll(yaml_stream);
+			return LoadAllYAML(yaml_str);
 		} else {
 			std::vector<YAML::Node> result;
-			result.push_back(YAML::Load(yaml_stream));
+			result.push_back(LoadYAML(yaml_str));
 			return result;
 		}
-	} catch (const std::exception &e) {
+	} catch (const YAML::Exception &e) {
 		throw InvalidInputException("Error parsing YAML: %s", e.what());
 	}
 }
 
+// Builds the node graph of one document from parser events, like yaml-cpp's
+// internal NodeBuilder, while enforcing the resource limits. Containers are
+// attached to their parent when they open, so every node joins the document's
+// node memory as it is created. Each anchor records the expanded size of its
+// node, so an alias adds the size of what a consumer will re-materialize.
+class BoundedNodeBuilder : public YAML::EventHandler {
+public:
+	BoundedNodeBuilder()
+	    : max_nodes(YAMLSettings::GetMaxExpansionNodes()), max_depth(YAMLSettings::GetMaxNestingDepth()),
+	      max_scalar_size(scope_max_scalar_size ? scope_max_scalar_size : YAMLSettings::GetMaxInputSize()),
+	      max_aliases(YAMLSettings::GetMaxAliasReferences()) {
+	}
+
+	YAML::Node root;
+	// Receives the start marks of the document's nodes when set (see YAMLSourceMarks)
+	YAMLSourceMarks *source_marks = nullptr;
+
+	void OnDocumentStart(const YAML::Mark &mark) override {
+	}
+	void OnDocumentEnd() override {
+	}
+
+	void OnNull(const YAML::Mark &mark, YAML::anchor_t anchor) override {
+		YAML::Node node(YAML::NodeType::Null);
+		RegisterAnchor(anchor, node);
+		Add(node, 1, mark);
+	}
+
+	void OnAlias(const YAML::Mark &mark, YAML::anchor_t anchor) override {
+		if (++aliases > max_aliases) {
+			throw InvalidInputException("YAML document has more than %llu alias references. Raise the limit with "
+			                            "yaml_set_max_alias_references(N) if this is a legitimate document.",
+			                            (unsigned long long)max_aliases);
+		}
+		if (anchor >= anchors.size()) {
+			throw InvalidInputException("YAML alias refers to an unknown anchor");
+		}
+		// An alias to a container that is still open (a recursive alias) counts as one node
+		Add(anchors[anchor].node, MaxValue<idx_t>(anchors[anchor].expanded, 1), mark);
+	}
+
+	void OnScalar(const YAML::Mark &mark, const std::string &tag, YAML::anchor_t anchor,
+	              const std::string &value) override {
+		if (value.size() > max_scalar_size) {
+			throw InvalidInputException("YAML scalar (%llu bytes) exceeds the maximum allowed size (%llu bytes). "
+			                            "Raise the limit with %s.",
+			                            (unsigned long long)value.size(), (unsigned long long)max_scalar_size,
+			                            scope_max_scalar_size ? "maximum_object_size" : "yaml_set_max_input_size(N)");
+		}
+		YAML::Node node(value);
+		node.SetTag(tag);
+		RegisterAnchor(anchor, node);
+		Add(node, 1, mark);
+	}
+
+	void OnSequenceStart(const YAML::Mark &mark, const std::string &tag, YAML::anchor_t anchor,
+	                     YAML::EmitterStyle::value style) override {
+		Open(YAML::NodeType::Sequence, mark, tag, anchor, style);
+	}
+	void OnSequenceEnd() override {
+		Close();
+	}
+
+	void OnMapStart(const YAML::Mark &mark, const std::string &tag, YAML::anchor_t anchor,
+	                YAML::EmitterStyle::value style) override {
+		Open(YAML::NodeType::Map, mark, tag, anchor, style);
+	}
+	void OnMapEnd() override {
+		Close();
+	}
+
+private:
+	struct Frame {
+		YAML::Node node;
+		bool is_map;
+		YAML::anchor_t anchor;
+		idx_t expanded; // Expanded size of the container so far (itself included)
+		YAML::Node key; // Pending key of a map entry
+		bool has_key;
+		YAMLSourceMarks *marks; // Marks of the container (nullptr when not tracked)
+	};
+	struct Anchor {
+		YAML::Node node;
+		idx_t expanded; // 0 while the anchored container is still open
+	};
+
+	void Open(YAML::NodeType::value type, const YAML::Mark &mark, const std::string &tag, YAML::anchor_t anchor,
+	          YAML::EmitterStyle::value style) {
+		if (frames.size() >= max_depth) {
+			ThrowNestingDepthExceeded(max_depth);
+		}
+		YAML::Node node(type);
+		node.SetTag(tag);
+		node.SetStyle(style);
+		RegisterAnchor(anchor, node);
+		Add(node, 1, mark);
+		frames.push_back(Frame {node, type == YAML::NodeType::Map, anchor, 1, YAML::Node(), false, added_marks});
+	}
+
+	void Close() {
+		auto frame = std::move(frames.back());
+		frames.pop_back();
+		if (frame.anchor) {
+			anchors[frame.anchor].expanded = frame.expanded;
+		}
+		if (!frames.empty()) {
+			// The container itself was counted by its parent when it opened
+			frames.back().expanded += frame.expanded - 1;
+		}
+	}
+
+	void RegisterAnchor(YAML::anchor_t anchor, const YAML::Node &node) {
+		if (!anchor) {
+			return;
+		}
+		if (anchors.size() <= anchor) {
+			anchors.resize(anchor + 1);
+		}
+		anchors[anchor] = Anchor {node, node.IsScalar() || node.IsNull() ? 1 : 0};
+	}
+
+	void Add(const YAML::Node &node, idx_t expanded, const YAML::Mark &mark) {
+		nodes += expanded;
+		if (nodes > max_nodes) {
+			ThrowNodeBudgetExceeded(max_nodes);
+		}
+		if (++events % YAML_INTERRUPT_CHECK_INTERVAL == 0) {
+			CheckInterrupted();
+		}
+		if (frames.empty()) {
+			// Node assignment would rebind shared node data; reset() points the handle instead
+			root.reset(node);
+			added_marks = source_marks;
+			if (added_marks) {
+				added_marks->mark = mark;
+			}
+			return;
+		}
+		auto &frame = frames.back();
+		frame.expanded += expanded;
+		// Map keys (and anything nested in them) have no entry in the marks tree
+		added_marks = nullptr;
+		if (frame.marks && (!frame.is_map || frame.has_key)) {
+			frame.marks->children.emplace_back();
+			added_marks = &frame.marks->children.back();
+			added_marks->mark = mark;
+		}
+		if (!frame.is_map) {
+			frame.node.push_back(node);
+		} else if (!frame.has_key) {
+			frame.key.reset(node);
+			frame.has_key = true;
+		} else {
+			// Appends without a key lookup (and keeps duplicate keys), as yaml-cpp's own builder does
+			frame.node.force_insert(frame.key, node);
+			frame.has_key = false;
+		}
+	}
+
+	idx_t max_nodes;
+	idx_t max_depth;
+	idx_t max_scalar_size;
+	idx_t max_aliases;
+	vector<Frame> frames;
+	vector<Anchor> anchors;
+	// Marks entry of the node last passed to Add, stays valid while that node is open
+	YAMLSourceMarks *added_marks = nullptr;
+	idx_t nodes = 0;
+	idx_t aliases = 0;
+	idx_t events = 0;
+};
+
+// Read-only stream over existing bytes, so parsing does not first copy them into a stringstream
+class YAMLInputStream : private std::streambuf, public std::istream {
+public:
+	YAMLInputStream(const char *data, idx_t size) : std::istream(this) {
+		auto begin = const_cast<char *>(data);
+		setg(begin, begin, begin + size);
+	}
+};
+
+YAML::Node LoadYAML(const char *data, idx_t size) {
+	YAMLInputStream stream(data, size);
+	YAML::Parser parser(stream);
+	BoundedNodeBuilder builder;
+	if (!parser.HandleNextDocument(builder)) {
+		return YAML::Node();
+	}
+	return builder.root;
+}
+
+YAML::Node LoadYAML(const std::string &input) {
+	return LoadYAML(input.data(), input.size());
+}
+
+YAML::Node LoadYAML(const std::string &input, YAMLSourceMarks &marks) {
+	YAMLInputStream stream(input.data(), input.size());
+	YAML::Parser parser(stream);
+	BoundedNodeBuilder builder;
+	builder.source_marks = &marks;
+	if (!parser.HandleNextDocument(builder)) {
+		return YAML::Node();
+	}
+	return builder.root;
+}
+
+std::vector<YAML::Node> LoadAllYAML(const std::string &input) {
+	YAMLInputStream stream(input.data(), input.size());
+	YAML::Parser parser(stream);
+	std::vector<YAML::Node> docs;
+	while (true) {
+		// One parser for the whole stream keeps directives in effect across documents as
+		// yaml-cpp defines; an interrupted query stops between documents
+		CheckInterrupted();
+		BoundedNodeBuilder builder;
+		if (!parser.HandleNextDocument(builder)) {
+			break;
+		}
+		docs.push_back(builder.root);
+	}
+	return docs;
+}
+
 YAMLStringStyle ResolveStringStyle(YAMLStringStyle style, YAMLFormat format) {
 	if (style != YAMLStringStyle::AUTO) {
 		return style;
@@ -156,9 +527,82 @@ void ConfigureEmitter(YAML::Emitter &out, YAMLFormat format, idx_t indent) {
 	}
 }
 
+// Hash of a collection and its direct children (scalars by value, collections by type and
+// size). Identical subtrees hash the same, and unlike a subtree hash it is computed without
+// walking the subtree, so it can be taken for every collection while writing.
+static hash_t YAMLShapeHash(const YAML::Node &node) {
+	auto hash_child = [](const YAML::Node &child) {
+		if (child.IsScalar()) {
+			return Hash(child.Scalar().c_str(), child.Scalar().size());
+		}
+		return CombineHash(Hash<uint64_t>(static_cast<uint64_t>(child.Type())), Hash<uint64_t>(child.size()));
+	};
+	hash_t hash = CombineHash(hash_child(node), Hash(node.Tag().c_str(), node.Tag().size()));
+	for (auto it = node.begin(); it != node.end(); ++it) {
+		if (node.IsMap()) {
+			hash = CombineHash(hash, CombineHash(hash_child(it->first), hash_child(it->second)));
+		} else {
+			hash = CombineHash(hash, hash_child(*it));
+		}
+	}
+	return hash;
+}
+
+// Collections referenced more than once (see YAMLSubtreeDeduplicator), bucketed by
+// YAMLShapeHash, and the anchor number each was given when first written (0 while not yet
+// written)
+struct YAMLAnchorState {
+	struct SharedNode {
+		YAML::Node node;
+		idx_t anchor_id;
+	};
+	std::unordered_map<hash_t, vector<SharedNode>> buckets;
+	idx_t next_anchor_id = 1;
+
+	void Add(const YAML::Node &node) {
+		auto &bucket = buckets[YAMLShapeHash(node)];
+		for (auto &shared : bucket) {
+			if (shared.node.is(node)) {
+				return;
+			}
+		}
+		bucket.push_back(SharedNode {node, 0});
+	}
+};
+
+// Write "&n" before the first occurrence of a shared collection; returns true when the
+// collection was already written and has been emitted as "*n" instead
+static bool EmitAnchorOrAlias(YAML::Emitter &out, const YAML::Node &node, YAMLAnchorState *anchors) {
+	if (!anchors || anchors->buckets.empty()) {
+		return false;
+	}
+	auto bucket = anchors->buckets.find(YAMLShapeHash(node));
+	if (bucket == anchors->buckets.end()) {
+		return false;
+	}
+	for (auto &shared : bucket->second) {
+		if (!shared.node.is(node)) {
+			continue;
+		}
+		if (shared.anchor_id != 0) {
+			out << YAML::Alias(std::to_string(shared.anchor_id));
+			return true;
+		}
+		shared.anchor_id = anchors->next_anchor_id++;
+		out << YAML::Anchor(std::to_string(shared.anchor_id));
+		return false;
+	}
+	return false;
+}
+
 static void EmitNodeWithStringStyleImpl(YAML::Emitter &out, const YAML::Node &node, YAMLStringStyle resolved_style,
-                                        YAMLTraversalBudget &budget) {
+                                        YAMLTraversalBudget &budget, YAMLAnchorState *anchors = nullptr) {
 	YAMLBudgetScope scope(budget);
+	if (node.IsSequence() || node.IsMap()) {
+		if (EmitAnchorOrAlias(out, node, anchors)) {
+			return;
+		}
+	}
 	switch (node.Type()) {
 	case YAML::NodeType::Scalar: {
 		const auto &scalar = node.Scalar();
@@ -173,7 +617,7 @@ static void EmitNodeWithStringStyleImpl(YAML::Emitter &out, const YAML::Node &no
 	case YAML::NodeType::Sequence: {
 		out << YAML::BeginSeq;
 		for (const auto &child : node) {
-			EmitNodeWithStringStyleImpl(out, child, resolved_style, budget);
+			EmitNodeWithStringStyleImpl(out, child, resolved_style, budget, anchors);
 		}
 		out << YAML::EndSeq;
 		break;
@@ -185,7 +629,7 @@ static void EmitNodeWithStringStyleImpl(YAML::Emitter &out, const YAML::Node &no
 			// Keys always use default emission (never literal)
 			out << pair.first;
 			out << YAML::Value;
-			EmitNodeWithStringStyleImpl(out, pair.second, resolved_style, budget);
+			EmitNodeWithStringStyleImpl(out, pair.second, resolved_style, budget, anchors);
 		}
 		out << YAML::EndMap;
 		break;
@@ -246,6 +690,215 @@ std::string EmitYAMLMultiDoc(const std::vector<YAML::Node> &docs, YAMLFormat for
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Source Spans
+//===--------------------------------------------------------------------===//
+
+static bool IsSpanSpace(char c) {
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Whether a quote at pos opens a quoted scalar: quotes only do at the start of a token
+// ("it's" is a plain scalar)
+static bool OpensQuotedScalar(const std::string &input, idx_t start, idx_t pos) {
+	if (input[pos] != '"' && input[pos] != '\'') {
+		return false;
+	}
+	return pos == start || IsSpanSpace(input[pos - 1]) || strchr("[{,:", input[pos - 1]);
+}
+
+// Position of the quote closing the quoted scalar opened at pos (at least input.size() if
+// it is not closed)
+static idx_t SkipQuotedScalar(const std::string &input, idx_t pos) {
+	if (input[pos] == '"') {
+		for (pos++; pos < input.size() && input[pos] != '"'; pos++) {
+			pos += input[pos] == '\\' ? 1 : 0;
+		}
+		return pos;
+	}
+	// '' is an escaped quote inside a single-quoted scalar
+	for (pos++; pos < input.size(); pos++) {
+		if (input[pos] == '\'' && (pos + 1 >= input.size() || input[pos + 1] != '\'')) {
+			break;
+		}
+		pos += input[pos] == '\'' ? 1 : 0;
+	}
+	return pos;
+}
+
+// End (inclusive) of the flow collection opening at start: brackets are matched while
+// skipping quoted scalars and comments
+static bool FindFlowSpanEnd(const std::string &input, idx_t start, idx_t &end) {
+	idx_t depth = 0;
+	for (idx_t pos = start; pos < input.size(); pos++) {
+		char c = input[pos];
+		if (OpensQuotedScalar(input, start, pos)) {
+			pos = SkipQuotedScalar(input, pos);
+		} else if (c == '#' && IsSpanSpace(input[pos - 1])) {
+			pos = input.find('\n', pos);
+		} else if (c == '[' || c == '{') {
+			depth++;
+		} else if (c == ']' || c == '}') {
+			if (--depth == 0) {
+				end = pos;
+				return true;
+			}
+		}
+		if (pos >= input.size()) {
+			break;
+		}
+	}
+	return false;
+}
+
+// Whether the mapping entry from content to line_end leaves its value to the following
+// lines ("key:" with nothing but a comment after the colon)
+static bool IsOpenKeyLine(const std::string &input, idx_t content, idx_t line_end) {
+	char last = 0;
+	for (idx_t pos = content; pos < line_end; pos++) {
+		if (OpensQuotedScalar(input, content, pos)) {
+			pos = SkipQuotedScalar(input, pos);
+			last = '"';
+		} else if (input[pos] == '#' && pos > content && IsSpanSpace(input[pos - 1])) {
+			break;
+		} else if (!IsSpanSpace(input[pos])) {
+			last = input[pos];
+		}
+	}
+	return last == ':';
+}
+
+// End (exclusive) of the block collection starting at start in the given column: the
+// following lines belong to it while they are indented further, or equally for another
+// entry of the same collection ("- " items of a sequence, keys of a mapping). A mapping
+// value may be an "indentless" sequence whose "- " items are in the mapping's own column.
+// Returns false for a line in the column that cannot be told apart from the next node.
+static bool FindBlockSpanEnd(const std::string &input, idx_t start, idx_t column, bool is_sequence, idx_t &end) {
+	auto line_end = input.find('\n', start);
+	end = line_end == std::string::npos ? input.size() : line_end;
+	// Whether a "- " item in the column continues the value of the mapping's last key
+	bool in_value = !is_sequence && IsOpenKeyLine(input, start, end);
+	for (idx_t line_start = end + 1; line_start < input.size(); line_start = line_end + 1) {
+		line_end = input.find('\n', line_start);
+		if (line_end == std::string::npos) {
+			line_end = input.size();
+		}
+		idx_t indent = 0;
+		idx_t content = line_start;
+		for (; content < line_end && input[content] == ' '; content++) {
+			indent++;
+		}
+		// Blank and comment-only lines are only kept when more of the node follows
+		if (content >= line_end || input[content] == '\r' || input[content] == '#') {
+			continue;
+		}
+		if (indent < column) {
+			break;
+		}
+		if (indent == column) {
+			bool has_dash = input[content] == '-' && (content + 1 >= line_end || IsSpanSpace(input[content + 1]));
+			bool is_marker = indent == 0 && line_end - content >= 3 &&
+			                 (input.compare(content, 3, "---") == 0 || input.compare(content, 3, "...") == 0);
+			if (is_marker || (is_sequence && !has_dash)) {
+				break;
+			}
+			if (!is_sequence) {
+				if (has_dash && !in_value) {
+					return false;
+				}
+				in_value = has_dash || IsOpenKeyLine(input, content, line_end);
+			}
+		}
+		end = line_end;
+	}
+	return true;
+}
+
+bool TryGetYAMLSourceSpan(const std::string &input, const YAML::Node &node, const YAML::Mark &mark,
+                          std::string &result) {
+	if (!node.IsSequence() && !node.IsMap()) {
+		return false;
+	}
+	if (mark.is_null() || mark.pos < 0 || idx_t(mark.pos) >= input.size() || mark.column < 0) {
+		return false;
+	}
+	// yaml-cpp does not count a byte order mark in its positions
+	if (input.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+		return false;
+	}
+	idx_t start = idx_t(mark.pos);
+	idx_t column = idx_t(mark.column);
+	auto line_start = input.rfind('\n', start);
+	if (start - (line_start == std::string::npos ? 0 : line_start + 1) != column) {
+		return false;
+	}
+
+	char first = input[start];
+	bool is_flow = first == '[' || first == '{';
+	idx_t end;
+	if (is_flow) {
+		if ((first == '[') != node.IsSequence() || !FindFlowSpanEnd(input, start, end)) {
+			return false;
+		}
+		end++;
+	} else {
+		if ((first == '-') != node.IsSequence() || strchr("&!*?|>", first)) {
+			return false;
+		}
+		if (!FindBlockSpanEnd(input, start, column, node.IsSequence(), end)) {
+			return false;
+		}
+	}
+	while (end > start && IsSpanSpace(input[end - 1])) {
+		end--;
+	}
+	// Anchors, aliases and tags would not survive being cut out of the document; the same
+	// characters inside quoted scalars ("*.yaml") are text
+	for (idx_t pos = start; pos < end; pos++) {
+		if (OpensQuotedScalar(input, start, pos)) {
+			pos = SkipQuotedScalar(input, pos);
+		} else if (input[pos] == '&' || input[pos] == '*' || input[pos] == '!') {
+			return false;
+		}
+	}
+
+	result.clear();
+	if (is_flow) {
+		result.append(input, start, end - start);
+		return true;
+	}
+	// Strip the node's own indentation from every line after the first
+	result.reserve(end - start);
+	for (idx_t pos = start; pos < end;) {
+		auto next = input.find('\n', pos);
+		idx_t line_end = next == std::string::npos || next > end ? end : next;
+		if (pos != start) {
+			for (idx_t skipped = 0; skipped < column && pos < line_end && input[pos] == ' '; skipped++) {
+				pos++;
+			}
+		}
+		result.append(input, pos, line_end - pos);
+		if (line_end < end) {
+			result += '\n';
+		}
+		pos = line_end + 1;
+	}
+	return true;
+}
+
+std::string YAMLNodeSourceText(const std::string &input, const YAML::Node &node, const YAMLSourceMarks *marks) {
+	std::string result;
+	if (marks && TryGetYAMLSourceSpan(input, node, marks->mark, result)) {
+		return result;
+	}
+	YAML::Emitter out;
+	out.SetIndent(2);
+	out.SetMapFormat(YAML::Flow);
+	out.SetSeqFormat(YAML::Flow);
+	out << node;
+	return out.c_str();
+}
+
 //===--------------------------------------------------------------------===//
 // YAML to JSON Conversion
 //===--------------------------------------------------------------------===//
@@ -478,7 +1131,7 @@ static void EmitValueToYAMLImpl(YAML::Emitter &out, const Value &value, YAMLTrav
 					const auto json_str = value.GetValue<string>();
 
 					// Parse JSON using YAML parser (yaml-cpp can parse JSON)
-					YAML::Node json_node = YAML::Load(json_str);
+					YAML::Node json_node = LoadYAML(json_str);
 
 					// Emit the parsed structure as YAML
 					out << json_node;
@@ -613,6 +1266,115 @@ void EmitValueToYAML(YAML::Emitter &out, const Value &value) {
 	EmitValueToYAMLImpl(out, value, budget);
 }
 
+//===--------------------------------------------------------------------===//
+// Subtree Deduplication
+//===--------------------------------------------------------------------===//
+
+static hash_t HashYAMLString(const std::string &str) {
+	return Hash(str.c_str(), str.size());
+}
+
+static bool YAMLNodesEqual(const YAML::Node &left, const YAML::Node &right) {
+	if (left.is(right)) {
+		return true;
+	}
+	if (left.Type() != right.Type() || left.Tag() != right.Tag()) {
+		return false;
+	}
+	switch (left.Type()) {
+	case YAML::NodeType::Scalar:
+		return left.Scalar() == right.Scalar();
+	case YAML::NodeType::Sequence:
+	case YAML::NodeType::Map: {
+		if (left.size() != right.size()) {
+			return false;
+		}
+		// Mappings compare in key order: the same pairs in another order emit differently
+		auto right_it = right.begin();
+		for (auto left_it = left.begin(); left_it != left.end(); ++left_it, ++right_it) {
+			if (left.IsMap() ? !YAMLNodesEqual(left_it->first, right_it->first) ||
+			                       !YAMLNodesEqual(left_it->second, right_it->second)
+			                 : !YAMLNodesEqual(*left_it, *right_it)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return true;
+	}
+}
+
+/**
+ * @brief Shares repeated collections within one document
+ *
+ * Subtrees are hashed bottom-up; a non-empty sequence or mapping identical to one seen
+ * earlier is replaced by a reference to that first occurrence. yaml-cpp then writes the
+ * first occurrence with an "&anchor" and every repeat as an "*alias".
+ */
+class YAMLSubtreeDeduplicator {
+public:
+	//! Deduplicate the children of node (recursively) and return the hash of its subtree
+	hash_t Deduplicate(YAML::Node node, YAMLTraversalBudget &budget) {
+		YAMLBudgetScope scope(budget);
+		switch (node.Type()) {
+		case YAML::NodeType::Scalar:
+			return CombineHash(HashYAMLString(node.Scalar()), HashYAMLString(node.Tag()));
+		case YAML::NodeType::Sequence: {
+			hash_t hash = Hash<uint64_t>(node.size());
+			for (auto it = node.begin(); it != node.end(); ++it) {
+				YAML::Node child = *it;
+				hash = CombineHash(hash, ShareChild(child, budget));
+			}
+			return hash;
+		}
+		case YAML::NodeType::Map: {
+			hash_t hash = CombineHash(Hash<uint64_t>(node.size()), HashYAMLString(node.Tag()));
+			for (auto it = node.begin(); it != node.end(); ++it) {
+				hash = CombineHash(hash, Deduplicate(it->first, budget));
+				YAML::Node child = it->second;
+				hash = CombineHash(hash, ShareChild(child, budget));
+			}
+			return hash;
+		}
+		default:
+			return Hash<uint64_t>(static_cast<uint64_t>(node.Type()));
+		}
+	}
+
+	//! Collections that were replaced by a reference at least once, for emitters that
+	//! write anchors themselves (see EmitNodeWithStringStyleImpl)
+	void GetSharedNodes(YAMLAnchorState &anchors) const {
+		for (auto &node : shared) {
+			anchors.Add(node);
+		}
+	}
+
+private:
+	hash_t ShareChild(YAML::Node &child, YAMLTraversalBudget &budget) {
+		auto shared_before = shared.size();
+		auto hash = Deduplicate(child, budget);
+		if ((!child.IsSequence() && !child.IsMap()) || child.size() == 0) {
+			return hash;
+		}
+		auto range = seen.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it) {
+			if (YAMLNodesEqual(it->second, child)) {
+				// Repeats inside this subtree are now unreachable and need no anchor
+				shared.resize(shared_before);
+				shared.push_back(it->second);
+				child = it->second;
+				return hash;
+			}
+		}
+		seen.emplace(hash, child);
+		return hash;
+	}
+
+	std::unordered_multimap<hash_t, YAML::Node> seen;
+	vector<YAML::Node> shared;
+};
+
 // Convert DuckDB Value to YAML::Node (respects emitter configuration)
 static YAML::Node ValueToYAMLNodeImpl(const Value &value, YAMLTraversalBudget &budget) {
 	YAMLBudgetScope scope(budget);
@@ -625,7 +1387,7 @@ static YAML::Node ValueToYAMLNodeImpl(const Value &value, YAMLTraversalBudget &b
 		if (value.type().IsJSONType()) {
 			try {
 				std::string json_str = value.GetValue<string>();
-				return YAML::Load(json_str); // Parse JSON as YAML
+				return LoadYAML(json_str); // Parse JSON as YAML
 			} catch (...) {
 				return YAML::Node(value.ToString());
 			}
@@ -675,17 +1437,28 @@ YAML::Node ValueToYAMLNode(const Value &value) {
 	return ValueToYAMLNodeImpl(value, budget);
 }
 
-std::string ValueToYAMLString(const Value &value, YAMLFormat format, YAMLStringStyle string_style, idx_t indent) {
+std::string ValueToYAMLString(const Value &value, YAMLFormat format, YAMLStringStyle string_style, idx_t indent,
+                              bool deduplicate) {
 	try {
 		// Convert to YAML::Node first (this respects emitter configuration)
 		YAML::Node node = ValueToYAMLNode(value);
 
+		// Repeated collections become references to their first occurrence
+		YAMLAnchorState anchors;
+		if (deduplicate) {
+			YAMLSubtreeDeduplicator deduplicator;
+			YAMLTraversalBudget budget;
+			deduplicator.Deduplicate(node, budget);
+			deduplicator.GetSharedNodes(anchors);
+		}
+
 		// Now emit with proper format settings and string style
 		YAML::Emitter out;
 		ConfigureEmitter(out, format, indent);
 		auto resolved = ResolveStringStyle(string_style, format);
 		if (resolved == YAMLStringStyle::LITERAL) {
-			EmitNodeWithStringStyle(out, node, resolved);
+			YAMLTraversalBudget budget;
+			EmitNodeWithStringStyleImpl(out, node, resolved, budget, &anchors);
 		} else {
 			out << node;
 		}